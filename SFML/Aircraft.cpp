@@ -37,7 +37,11 @@
 #include "Utility.h"
 #include "Category.h"
 #include "TextNode.h"
+#include "BulletNode.h"
+#include "SpriteBatch.h"
 #include "CommandQueue.h"
+#include "Random.h"
+#include "Profiler.h"
 
 #include <string>
 
@@ -47,14 +51,15 @@ namespace GEX
 { 
 	namespace
 	{
-		const std::map<Aircraft::Type, AircraftData> TABLE = initializeAircraftData();
+		const AircraftTable TABLE = initializeAircraftData();
 	}
 	
-	Aircraft::Aircraft(Aircraft::Type type, const TextureManager& textures)
-		: Entity(TABLE.at(type).hitpoints)
+	Aircraft::Aircraft(Aircraft::Type type, const TextureManager& textures, Random& random)
+		: Entity(TABLE[type].hitpoints)
 		, type_(type)
-		, sprite_(textures.get(TABLE.at(type).texture), TABLE.at(type).textureRect)
-		, explosion_(textures.get(TextureID::Explosion))
+		, random_(random)
+		, sprite_(textures.makeSprite(TABLE[type].texture, TABLE[type].textureRect))
+		, explosion_(textures.find(TextureID::Explosion), textures.getSize(TextureID::Explosion))
 		, showExplosion_(true)
 		, healthDisplay_(nullptr)
 		, missileDisplay_(nullptr)
@@ -80,11 +85,11 @@ namespace GEX
 		centerOrigin(sprite_);
 
 		//Set up Commands
-		fireCommand_.category = Category::SceneAirLayer;
-		fireCommand_.action = [this, &textures] (SceneNode& node, sf::Time dt) 
+		fireCommand_.category = Category::BulletSystem;
+		fireCommand_.action = derivedAction<BulletNode>([this] (BulletNode& bullets, sf::Time dt) 
 		{
-			createBullets(node, textures);
-		};
+			createBullets(bullets);
+		});
 
 		launchMissileCommand_.category = Category::SceneAirLayer;
 		launchMissileCommand_.action = [this, &textures](SceneNode& node, sf::Time dt)
@@ -128,6 +133,8 @@ namespace GEX
 
 	void Aircraft::updateTexts()
 	{
+		GEX_PROFILE_SCOPE("Aircraft::updateTexts");
+
 		// Display hitpoints
 		if (isDestroyed())
 			healthDisplay_->setString("");
@@ -149,9 +156,9 @@ namespace GEX
 
 	void Aircraft::updateRollAnimation()
 	{
-		if (TABLE.at(type_).hasRollAnimation)
+		if (TABLE[type_].hasRollAnimation)
 		{
-			sf::IntRect	textureRect = TABLE.at(type_).textureRect;
+			sf::IntRect	textureRect = TABLE[type_].textureRect;
 
 			// Roll left or right depending on velocity
 			if (getVelocity().x < 0.f)
@@ -165,7 +172,7 @@ namespace GEX
 
 	void Aircraft::fire()
 	{
-		if (TABLE.at(type_).fireInterval != sf::Time::Zero)
+		if (TABLE[type_].fireInterval != sf::Time::Zero)
 			isFiring_ = true;
 	}
 
@@ -196,6 +203,15 @@ namespace GEX
 		return getWorldTransform().transformRect(sprite_.getGlobalBounds());
 	}
 
+	sf::FloatRect Aircraft::getDrawBounds() const
+	{
+		// the explosion is a lot larger than the aircraft
+		if (isDestroyed() && showExplosion_)
+			return getWorldTransform().transformRect(explosion_.getGlobalBounds());
+		else
+			return getBoundingBox();
+	}
+
 	bool Aircraft::isMarkedForRemoval() const
 	{
 		return isDestroyed() && (explosion_.isFinished() || !showExplosion_);
@@ -237,7 +253,7 @@ namespace GEX
 	void Aircraft::updateMovementPattern(sf::Time dt)
 	{
 		// movement pattern
-		const std::vector<Direction>& directions = TABLE.at(type_).directions;
+		const std::vector<Direction>& directions = TABLE[type_].directions;
 
 		if (!directions.empty())
 		{
@@ -258,33 +274,42 @@ namespace GEX
 
 	float Aircraft::getMaxSpeed() const
 	{
-		return TABLE.at(type_).speed;
+		return TABLE[type_].speed;
 	}
 
-	void Aircraft::createBullets(SceneNode & node, const TextureManager & textures)
+	void Aircraft::createBullets(BulletNode & bullets) const
 	{
 		Projectile::Type type = isAllied() ? Projectile::Type::AlliedBullet : Projectile::Type::EnemyBullet;
 
 		switch (fireSpreadLevel_)
 		{
 		case 1:
-			createProjectile(node, type, 0.f, 0.5f, textures);
+			createBullet(bullets, type, 0.f, 0.5f);
 			break;
 		case 2:
-			createProjectile(node, type, -0.33f, 0.5f, textures);
-			createProjectile(node, type, +0.33f, 0.5f, textures);
+			createBullet(bullets, type, -0.33f, 0.5f);
+			createBullet(bullets, type, +0.33f, 0.5f);
 			break;
 		case 3:
-			createProjectile(node, type, -0.5f, 0.5f, textures);
-			createProjectile(node, type, 0.f, 0.5f, textures);
-			createProjectile(node, type, +0.5f, 0.5f, textures);
+			createBullet(bullets, type, -0.5f, 0.5f);
+			createBullet(bullets, type, 0.f, 0.5f);
+			createBullet(bullets, type, +0.5f, 0.5f);
 			break;
 		}
 	}
 
+	void Aircraft::createBullet(BulletNode & bullets, Projectile::Type type, float xoffset, float yoffset) const
+	{
+		sf::Vector2f offset(xoffset * sprite_.getGlobalBounds().width, yoffset * sprite_.getGlobalBounds().height);
+		sf::Vector2f velocity(0, bullets.getMaxSpeed(type));
+		float sign = isAllied() ? -1.f : 1.f;
+
+		bullets.addBullet(type, getWorldPosition() + offset * sign, velocity * sign);
+	}
+
 	void Aircraft::createProjectile(SceneNode & node, Projectile::Type type, float xoffset, float yoffset, const TextureManager & textures)
 	{
-		std::unique_ptr<Projectile> projectile(new Projectile(type, textures));
+		auto projectile = makePooledNode<Projectile>(type, textures);
 
 		sf::Vector2f offset(xoffset * sprite_.getGlobalBounds().width, yoffset * sprite_.getGlobalBounds().height);
 		sf::Vector2f velocity(0, projectile->getMaxSpeed());
@@ -297,9 +322,9 @@ namespace GEX
 
 	void Aircraft::createPickup(SceneNode & node, const TextureManager & textures) const
 	{
-		auto type = static_cast<Pickup::Type>(randomInt(static_cast<int>(Pickup::Type::Count)));
+		auto type = static_cast<Pickup::Type>(random_.nextInt(static_cast<int>(Pickup::Type::Count)));
 
-		std::unique_ptr<Pickup> pickup(new Pickup(type, textures));
+		auto pickup = makePooledNode<Pickup>(type, textures);
 		pickup->setPosition(getWorldPosition());
 		pickup->setVelocity(0.f, 0.f);
 		node.attachChild(std::move(pickup));
@@ -307,8 +332,9 @@ namespace GEX
 
 	void Aircraft::checkPickupDrop(CommandQueue & commands)
 	{
-		if (!isAllied() && randomInt(3) == 0 && !spawnPickup_)
-			commands.push(dropPickupCommand_);
+		// roll once, not on every frame of the explosion
+		if (!isAllied() && !spawnPickup_ && random_.nextInt(3) == 0)
+			commands.push(dropPickupCommand_.clone());
 
 		spawnPickup_ = true;
 	}
@@ -322,9 +348,9 @@ namespace GEX
 		//Bullets
 		if (isFiring_ && fireCountDown_ <= sf::Time::Zero)
 		{
-			commands.push(fireCommand_);
+			commands.push(fireCommand_.clone());
 			isFiring_ = false;
-			fireCountDown_ = TABLE.at(type_).fireInterval / (fireRateLevel_ + 1.f);
+			fireCountDown_ = TABLE[type_].fireInterval / (fireRateLevel_ + 1.f);
 		}
 		else if (fireCountDown_ > sf::Time::Zero)
 		{
@@ -336,7 +362,7 @@ namespace GEX
 		{ 
 			if(missileAmmo_ > 0)
 			{ 
-				commands.push(launchMissileCommand_);
+				commands.push(launchMissileCommand_.clone());
 				isLaunchingMissiles_ = false;
 				--missileAmmo_;
 			}
@@ -350,4 +376,12 @@ namespace GEX
 		else
 			target.draw(sprite_, states);
 	}
+
+	void Aircraft::batchCurrent(SpriteBatch & batch, sf::RenderStates states) const
+	{
+		if (isDestroyed() && showExplosion_)
+			explosion_.batch(batch, states);
+		else
+			batch.add(sprite_, states.transform);
+	}
 }
\ No newline at end of file
@@ -46,6 +46,9 @@
 
 namespace GEX
 {
+	class BulletNode;
+	class Random;
+
 	class Aircraft : public Entity
 	{
 	public:
@@ -53,13 +56,15 @@ namespace GEX
 		{
 			Eagle,
 			Raptor,
-			Avenger
+			Avenger,
+			Count
 		};
 
 	public:
-								Aircraft(Aircraft::Type type, const TextureManager& textures);
+								Aircraft(Aircraft::Type type, const TextureManager& textures, Random& random);
 		
 		void					drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		void					batchCurrent(SpriteBatch& batch, sf::RenderStates states) const override;
 		unsigned int			getCategory() const override;
 
 		bool					isAllied() const;
@@ -71,6 +76,7 @@ namespace GEX
 		void					increaseFireSpread();
 		void					collectMissiles(unsigned int count);
 		sf::FloatRect			getBoundingBox() const override;
+		sf::FloatRect			getDrawBounds() const override;
 
 		bool					isMarkedForRemoval() const override;
 
@@ -83,7 +89,8 @@ namespace GEX
 		void					updateMovementPattern(sf::Time dt);
 		float					getMaxSpeed() const;
 
-		void					createBullets(SceneNode& node, const TextureManager& textures);
+		void					createBullets(BulletNode& bullets) const;
+		void					createBullet(BulletNode& bullets, Projectile::Type type, float xoffset, float yoffset) const;
 		void					createProjectile(SceneNode& node, Projectile::Type type, 
 												 float xoffset, float yoffset, const TextureManager& textures);
 		void					createPickup(SceneNode& node, const TextureManager& textures) const;
@@ -96,6 +103,7 @@ namespace GEX
 
 	private:
 		Type					type_;
+		Random&					random_;
 		sf::Sprite				sprite_;
 		Animation				explosion_;
 		bool					showExplosion_;
@@ -0,0 +1,303 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* AllocationTracker Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#include "AllocationTracker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace GEX
+{
+	namespace
+	{
+		// constant initialized, so they are ready before any static constructor allocates
+		std::atomic<std::size_t> allocations(0);
+		std::atomic<std::size_t> frees(0);
+		std::atomic<std::size_t> bytesAllocated(0);
+		std::atomic<std::size_t> bytesInUse(0);
+		std::atomic<std::size_t> peakBytesInUse(0);
+
+		// plain arrays, so operator new can count into them without allocating itself.
+		// Entry 0 takes allocations outside any scope and those past MAX_SCOPES.
+		thread_local AllocationTracker::Counters scopes[AllocationTracker::MAX_SCOPES];
+		thread_local std::size_t scopeCount = 1;
+		thread_local std::size_t currentScope = 0;
+
+		// the inclusive counters take the thread's running totals across the outermost
+		// entry of each scope, so a recursive scope isn't counted twice
+		thread_local AllocationTracker::Counters threadTotal = {};
+		thread_local AllocationTracker::Counters inclusiveScopes[AllocationTracker::MAX_SCOPES];
+		thread_local AllocationTracker::Counters scopeEntries[AllocationTracker::MAX_SCOPES];
+		thread_local std::size_t scopeDepths[AllocationTracker::MAX_SCOPES];
+
+		thread_local AllocationTracker::Counters currentFrame = {};
+		thread_local AllocationTracker::Counters lastFrame = {};
+		thread_local std::size_t frameCount = 0;
+	}
+
+	bool AllocationTracker::isEnabled()
+	{
+		return GEX_ALLOCATION_TRACKING != 0;
+	}
+
+	AllocationTracker::Statistics AllocationTracker::getStatistics()
+	{
+		Statistics statistics;
+		statistics.allocations = allocations;
+		statistics.frees = frees;
+		statistics.bytesAllocated = bytesAllocated;
+		statistics.bytesInUse = bytesInUse;
+		statistics.peakBytesInUse = peakBytesInUse;
+
+		return statistics;
+	}
+
+	void AllocationTracker::resetPeak()
+	{
+		peakBytesInUse = bytesInUse.load();
+	}
+
+	void AllocationTracker::endFrame()
+	{
+		lastFrame = currentFrame;
+		currentFrame = Counters();
+		++frameCount;
+	}
+
+	AllocationTracker::Counters AllocationTracker::getLastFrame()
+	{
+		return lastFrame;
+	}
+
+	std::size_t AllocationTracker::getFrameCount()
+	{
+		return frameCount;
+	}
+
+	std::vector<AllocationTracker::Counters> AllocationTracker::getTopScopes(std::size_t count)
+	{
+		std::vector<Counters> top;
+		for (std::size_t i = 0; i < scopeCount; ++i)
+		{
+			if (scopes[i].allocations > 0)
+				top.push_back(scopes[i]);
+		}
+
+		for (Counters& scope : top)
+		{
+			if (!scope.name)
+				scope.name = "(other)";
+		}
+
+		std::sort(top.begin(), top.end(), [](const Counters& lhs, const Counters& rhs)
+		{
+			return lhs.allocations > rhs.allocations;
+		});
+
+		if (top.size() > count)
+			top.resize(count);
+
+		return top;
+	}
+
+	AllocationTracker::Counters AllocationTracker::getInclusiveScope(const char* name)
+	{
+		for (std::size_t i = 1; i < scopeCount; ++i)
+		{
+			if (std::strcmp(scopes[i].name, name) == 0)
+			{
+				Counters scope = inclusiveScopes[i];
+				scope.name = name;
+				return scope;
+			}
+		}
+
+		Counters none = {};
+		none.name = name;
+		return none;
+	}
+
+	std::size_t AllocationTracker::enterScope(const char* name)
+	{
+		std::size_t previous = currentScope;
+
+		// the same literal can have a different address in every translation unit, so
+		// compare the text; this runs on scope entry, not on every allocation
+		std::size_t index = 1;
+		while (index < scopeCount && std::strcmp(scopes[index].name, name) != 0)
+			++index;
+
+		if (index == scopeCount)
+		{
+			if (scopeCount == MAX_SCOPES)
+				index = 0;
+			else
+				scopes[scopeCount++].name = name;
+		}
+
+		if (scopeDepths[index]++ == 0)
+			scopeEntries[index] = threadTotal;
+
+		currentScope = index;
+		return previous;
+	}
+
+	void AllocationTracker::leaveScope(std::size_t previous)
+	{
+		if (--scopeDepths[currentScope] == 0)
+		{
+			const Counters& entry = scopeEntries[currentScope];
+			Counters& inclusive = inclusiveScopes[currentScope];
+			inclusive.allocations += threadTotal.allocations - entry.allocations;
+			inclusive.frees += threadTotal.frees - entry.frees;
+			inclusive.bytesAllocated += threadTotal.bytesAllocated - entry.bytesAllocated;
+		}
+
+		currentScope = previous;
+	}
+
+#if GEX_ALLOCATION_TRACKING
+	namespace
+	{
+		// every block carries its size in front, so delete knows how much to give back
+		const std::size_t HEADER_SIZE = alignof(std::max_align_t);
+
+		void* trackedAllocate(std::size_t size)
+		{
+			void* block = std::malloc(size + HEADER_SIZE);
+			if (!block)
+				return nullptr;
+
+			*static_cast<std::size_t*>(block) = size;
+
+			++allocations;
+			bytesAllocated += size;
+			std::size_t inUse = bytesInUse += size;
+
+			std::size_t peak = peakBytesInUse;
+			while (inUse > peak && !peakBytesInUse.compare_exchange_weak(peak, inUse))
+				;
+
+			++currentFrame.allocations;
+			currentFrame.bytesAllocated += size;
+			++threadTotal.allocations;
+			threadTotal.bytesAllocated += size;
+			++scopes[currentScope].allocations;
+			scopes[currentScope].bytesAllocated += size;
+
+			return static_cast<char*>(block) + HEADER_SIZE;
+		}
+
+		void trackedFree(void* pointer)
+		{
+			if (!pointer)
+				return;
+
+			void* block = static_cast<char*>(pointer) - HEADER_SIZE;
+			bytesInUse -= *static_cast<std::size_t*>(block);
+			std::free(block);
+
+			++frees;
+			++currentFrame.frees;
+			++threadTotal.frees;
+			++scopes[currentScope].frees;
+		}
+
+		void* trackedAllocateOrThrow(std::size_t size)
+		{
+			void* pointer = trackedAllocate(size);
+			if (!pointer)
+				throw std::bad_alloc();
+
+			return pointer;
+		}
+	}
+#endif
+}
+
+#if GEX_ALLOCATION_TRACKING
+void* operator new(std::size_t size)
+{
+	return GEX::trackedAllocateOrThrow(size);
+}
+
+void* operator new[](std::size_t size)
+{
+	return GEX::trackedAllocateOrThrow(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	return GEX::trackedAllocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	return GEX::trackedAllocate(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+	GEX::trackedFree(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+	GEX::trackedFree(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+	GEX::trackedFree(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+	GEX::trackedFree(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+	GEX::trackedFree(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+	GEX::trackedFree(pointer);
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,100 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* AllocationTracker Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// Define GEX_TRACK_ALLOCATIONS to replace the global operator new and delete with
+// counting versions. Without it nothing is replaced and every count reads zero.
+#if defined(GEX_TRACK_ALLOCATIONS)
+#define GEX_ALLOCATION_TRACKING 1
+#else
+#define GEX_ALLOCATION_TRACKING 0
+#endif
+
+namespace GEX
+{
+	// Heap counters. The totals are process wide; frame and scope counters belong to
+	// the calling thread, so the game's numbers aren't mixed with batch workers'.
+	class AllocationTracker
+	{
+	public:
+		static const std::size_t	MAX_SCOPES = 64;			// later scopes share one "(other)" entry
+
+		struct Statistics
+		{
+			std::size_t			allocations;	// calls to operator new since start
+			std::size_t			frees;
+			std::size_t			bytesAllocated;
+			std::size_t			bytesInUse;
+			std::size_t			peakBytesInUse;
+		};
+
+		struct Counters
+		{
+			const char*			name;			// scope name, null for a frame
+			std::size_t			allocations;
+			std::size_t			frees;
+			std::size_t			bytesAllocated;
+		};
+
+	public:
+		static bool				isEnabled();
+		static Statistics		getStatistics();
+
+			// starts a new peak from what is in use right now
+		static void				resetPeak();
+
+			// closes the calling thread's frame; its counters move to getLastFrame()
+		static void				endFrame();
+		static Counters			getLastFrame();
+		static std::size_t		getFrameCount();
+
+			// the count scopes with the most allocations since start, most first
+		static std::vector<Counters>	getTopScopes(std::size_t count);
+
+			// the calling thread's counters for the named scope since start, scopes nested in
+			// it included; a scope adds to them when it is left, all zero if it never ran.
+			// Allocates nothing, so it can be read between the steps of a frame
+		static Counters			getInclusiveScope(const char* name);
+
+			// makes name the scope new allocations are counted against and returns a handle
+			// to the previous one for leaveScope(); ProfileScope does this for every scope
+		static std::size_t		enterScope(const char* name);
+		static void				leaveScope(std::size_t previous);
+	};
+}
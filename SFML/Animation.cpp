@@ -36,11 +36,13 @@
 #include <SFML/Graphics/RenderStates.hpp>
 
 #include "Animation.h"
+#include "SpriteBatch.h"
 
 namespace GEX
 { 
 	Animation::Animation()
 		: sprite_()
+		, textureSize_()
 		, frameSize_()
 		, numberOfFrames_(0)
 		, currentFrame_(0)
@@ -51,7 +53,13 @@ namespace GEX
 	}
 
 	Animation::Animation(const sf::Texture & texture)
-		: sprite_(texture)
+		: Animation(&texture, texture.getSize())
+	{
+	}
+
+	Animation::Animation(const sf::Texture * texture, sf::Vector2u textureSize)
+		: sprite_()
+		, textureSize_(textureSize)
 		, frameSize_()
 		, numberOfFrames_(0)
 		, currentFrame_(0)
@@ -59,11 +67,14 @@ namespace GEX
 		, elapsedTime_(sf::Time::Zero)
 		, repeat_(false)
 	{
+		if (texture)
+			sprite_.setTexture(*texture, true);
 	}
 
 	void Animation::setTexture(const sf::Texture & texture)
 	{
 		sprite_.setTexture(texture);
+		textureSize_ = texture.getSize();
 	}
 
 	const sf::Texture * Animation::getTexture() const
@@ -136,7 +147,7 @@ namespace GEX
 		sf::Time timePerFrame = duration_ / static_cast<float>(numberOfFrames_);
 		elapsedTime_ += dt;
 
-		sf::Vector2i textureBounds(sprite_.getTexture()->getSize());
+		sf::Vector2i textureBounds(textureSize_);
 		sf::IntRect	 textureRect = sprite_.getTextureRect();
 
 		if (currentFrame_ == 0)
@@ -179,4 +190,10 @@ namespace GEX
 		states.transform *= getTransform();
 		target.draw(sprite_, states);
 	}
+
+	void Animation::batch(SpriteBatch& batch, sf::RenderStates states) const
+	{
+		states.transform *= getTransform();
+		batch.add(sprite_, states.transform);
+	}
 }
\ No newline at end of file
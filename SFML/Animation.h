@@ -43,12 +43,17 @@
 
 namespace GEX
 { 
+	class SpriteBatch;
+
 	class Animation : public sf::Drawable, public sf::Transformable
 	{
 	public:
 							Animation();
 							Animation(const sf::Texture& texture);
 
+			// texture may be null for a placeholder sheet; frames still step through textureSize
+							Animation(const sf::Texture* texture, sf::Vector2u textureSize);
+
 		void				setTexture(const sf::Texture& texture);
 		const sf::Texture*	getTexture() const;
 
@@ -72,11 +77,15 @@ namespace GEX
 
 		void				update(sf::Time dt);
 
+			// hands the current frame to the batch instead of drawing it
+		void				batch(SpriteBatch& batch, sf::RenderStates states) const;
+
 	private:
 		void				draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
 	private:
 		sf::Sprite			sprite_;
+		sf::Vector2u		textureSize_;
 		sf::Vector2i		frameSize_;
 		std::size_t			numberOfFrames_;
 		std::size_t			currentFrame_;
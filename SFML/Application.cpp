@@ -40,6 +40,42 @@
 #include "GEXState.h"
 #include "GameOverState.h"
 #include "FontManager.h"
+#include "SceneNode.h"
+#include "Projectile.h"
+#include "Pickup.h"
+#include "EmitterNode.h"
+#include "ObjectPool.h"
+#include "CollisionMatrix.h"
+#include "ParticleBudget.h"
+#include "Profiler.h"
+#include "AllocationTracker.h"
+
+namespace
+{
+	// share of the last second's spawns that reused a slot from the pool's free list
+	template <typename T>
+	std::string poolHitRate()
+	{
+		typename GEX::ObjectPool<T>::Statistics statistics = GEX::ObjectPool<T>::getInstance().getStatistics();
+		std::size_t requests = statistics.hits + statistics.misses;
+
+		if (requests == 0)
+			return "-";
+
+		return std::to_string(statistics.hits * 100 / requests) + "%";
+	}
+
+	// "p50 / p95 / p99 / max" of the rolling window, in microseconds
+	std::string formatPercentiles(const GEX::FrameTimeHistogram& histogram)
+	{
+		GEX::FrameTimeHistogram::Percentiles percentiles = histogram.getPercentiles();
+
+		return std::to_string(percentiles.p50.asMicroseconds()) + " / " +
+			std::to_string(percentiles.p95.asMicroseconds()) + " / " +
+			std::to_string(percentiles.p99.asMicroseconds()) + " / " +
+			std::to_string(percentiles.max.asMicroseconds()) + " us";
+	}
+}
 
 const sf::Time Application::TimePerFrame = sf::seconds(1.0f / 60.0f);		//seconds per frame for 60 fps
 
@@ -52,6 +88,11 @@ Application::Application()
 	, statisticsText_()
 	, statisticsUpdateTime_()
 	, statisticsNumFrames_(0)
+	, updateTimes_()
+	, renderTimes_()
+	, frameTimes_()
+	, frameLog_()
+	, frameNumber_(0)
 {
 	window_.setKeyRepeatEnabled(false);
 
@@ -63,7 +104,7 @@ Application::Application()
 	statisticsText_.setFont(GEX::FontManager::getInstance().get(GEX::FontID::Main));
 	statisticsText_.setPosition(15.0f, 15.0f);
 	statisticsText_.setCharacterSize(15);
-	statisticsText_.setString("Frames Per Second = \nTime / Update = ");
+	statisticsText_.setString("Frames Per Second = \nTime / Update = \nTransforms Saved / Frame = \nNodes Drawn / Frame = \nPool Hits = \nCollision Pairs / Frame = \nParticles = \nUpdate p50/p95/p99/max = \nRender p50/p95/p99/max = \nFrame p50/p95/p99/max = ");
 
 	registerStates();
 	stateStack_.pushState(GEX::StateID::Title);
@@ -72,17 +113,27 @@ Application::Application()
 void Application::run()
 {
 	sf::Clock clock;
+	sf::Clock frameClock;
 	sf::Time timeSinceLastUpdate = sf::Time::Zero;
 
 	while (window_.isOpen())
 	{
 		timeSinceLastUpdate += clock.restart();
 
+		unsigned int updates = 0;
+		sf::Time updateTime = sf::Time::Zero;
+
 		while (timeSinceLastUpdate > TimePerFrame)
 		{
+			sf::Clock updateClock;
 			processInput();
 			update(TimePerFrame);
 
+			sf::Time stepTime = updateClock.getElapsedTime();
+			updateTimes_.add(stepTime);
+			updateTime += stepTime;
+			++updates;
+
 			if (stateStack_.isEmpty())
 				window_.close();
 
@@ -92,12 +143,27 @@ void Application::run()
 
 		updateStatistics(timeSinceLastUpdate);
 
+		sf::Clock renderClock;
 		render();
+
+		recordFrame(updates, updateTime, renderClock.getElapsedTime(), frameClock.restart());
+		GEX::AllocationTracker::endFrame();
 	}
 }
 
+bool Application::openFrameLog(const std::string& path)
+{
+	frameLog_.open(path);
+	if (!frameLog_)
+		return false;
+
+	frameLog_ << "frame,updates,update_us,render_us,frame_us\n";
+	return true;
+}
+
 void Application::processInput()
 {
+	GEX_PROFILE_SCOPE("Application::processInput");
 	sf::Event event;
 
 	while (window_.pollEvent(event))
@@ -111,11 +177,13 @@ void Application::processInput()
 
 void Application::update(sf::Time dt)
 {
+	GEX_PROFILE_SCOPE("Application::update");
 	stateStack_.update(dt);
 }
 
 void Application::render()
 {
+	GEX_PROFILE_SCOPE("Application::render");
 	window_.clear();
 	stateStack_.draw();
 
@@ -131,14 +199,56 @@ void Application::updateStatistics(sf::Time dt)
 
 	if (statisticsUpdateTime_ > sf::seconds(1))
 	{
+		// world transforms served from the SceneNode cache instead of a parent chain walk
+		GEX::SceneNode::TransformStatistics transforms = GEX::SceneNode::getTransformStatistics();
+		GEX::SceneNode::DrawStatistics nodes = GEX::SceneNode::getDrawStatistics();
+		GEX::CollisionMatrix::Statistics pairs = GEX::CollisionMatrix::getStatistics();
+		GEX::ParticleBudget::Statistics particles = GEX::ParticleBudget::getStatistics();
+
 		statisticsText_.setString("Frames Per Second = " + std::to_string(statisticsNumFrames_) + "\n" +
-			"Time / Update = " + std::to_string(statisticsUpdateTime_.asMicroseconds() / statisticsNumFrames_));
+			"Time / Update = " + std::to_string(statisticsUpdateTime_.asMicroseconds() / statisticsNumFrames_) + "\n" +
+			"Transforms Saved / Frame = " + std::to_string(transforms.reused / statisticsNumFrames_) +
+			" (recomputed " + std::to_string(transforms.recomputed / statisticsNumFrames_) + ")\n" +
+			"Nodes Drawn / Frame = " + std::to_string(nodes.drawn / statisticsNumFrames_) +
+			" (culled " + std::to_string(nodes.culled / statisticsNumFrames_) + ")\n" +
+			"Pool Hits = Projectile " + poolHitRate<GEX::Projectile>() +
+			"  Pickup " + poolHitRate<GEX::Pickup>() +
+			"  Emitter " + poolHitRate<GEX::EmitterNode>() + "\n" +
+			"Collision Pairs / Frame = " + std::to_string(pairs.tested / statisticsNumFrames_) +
+			" (rejected " + std::to_string(pairs.rejected / statisticsNumFrames_) + ")\n" +
+			"Particles = " + std::to_string(particles.particleCount) + " / " + std::to_string(particles.maxParticles) +
+			" (culled " + std::to_string(particles.culled) +
+			", emission " + std::to_string(static_cast<int>(particles.emissionScale * 100.f)) + "%)\n" +
+			"Update p50/p95/p99/max = " + formatPercentiles(updateTimes_) + "\n" +
+			"Render p50/p95/p99/max = " + formatPercentiles(renderTimes_) + "\n" +
+			"Frame p50/p95/p99/max = " + formatPercentiles(frameTimes_));
 
+		GEX::SceneNode::resetTransformStatistics();
+		GEX::SceneNode::resetDrawStatistics();
+		GEX::CollisionMatrix::resetStatistics();
+		GEX::ParticleBudget::resetStatistics();
+		GEX::ObjectPool<GEX::Projectile>::getInstance().resetStatistics();
+		GEX::ObjectPool<GEX::Pickup>::getInstance().resetStatistics();
+		GEX::ObjectPool<GEX::EmitterNode>::getInstance().resetStatistics();
 		statisticsUpdateTime_ -= sf::seconds(1);
 		statisticsNumFrames_ = 0;
 	}
 }
 
+void Application::recordFrame(unsigned int updates, sf::Time updateTime, sf::Time renderTime, sf::Time frameTime)
+{
+	renderTimes_.add(renderTime);
+	frameTimes_.add(frameTime);
+
+	if (frameLog_.is_open())
+	{
+		frameLog_ << frameNumber_ << ',' << updates << ',' << updateTime.asMicroseconds() << ','
+			<< renderTime.asMicroseconds() << ',' << frameTime.asMicroseconds() << '\n';
+	}
+
+	++frameNumber_;
+}
+
 void Application::registerStates()
 {
 	stateStack_.registerState<TitleState>(GEX::StateID::Title);
@@ -36,12 +36,16 @@
 #include "PlayerControl.h"
 #include "TextureManager.h"
 #include "StateStack.h"
+#include "FrameTimeHistogram.h"
 
 #include <SFML\System\Time.hpp>
 #include <SFML\Graphics\RenderWindow.hpp>
 #include <SFML\Graphics\Font.hpp>
 #include <SFML\Graphics\Text.hpp>
 
+#include <fstream>
+#include <string>
+
 
 class Application
 {
@@ -50,12 +54,16 @@ class Application
 
 		void						run();
 
+			// writes one CSV row of timings per frame to path; false if it can't be opened
+		bool						openFrameLog(const std::string& path);
+
 	private:
 		void						processInput();
 		void						update(sf::Time dt);
 		void						render();
 
 		void						updateStatistics(sf::Time dt);
+		void						recordFrame(unsigned int updates, sf::Time updateTime, sf::Time renderTime, sf::Time frameTime);
 		void						registerStates();
 
 	private:
@@ -70,4 +78,11 @@ class Application
 		sf::Text					statisticsText_;
 		sf::Time					statisticsUpdateTime_;
 		unsigned int				statisticsNumFrames_;
+
+		GEX::FrameTimeHistogram		updateTimes_;
+		GEX::FrameTimeHistogram		renderTimes_;
+		GEX::FrameTimeHistogram		frameTimes_;
+
+		std::ofstream				frameLog_;
+		unsigned int				frameNumber_;
 };
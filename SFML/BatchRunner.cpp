@@ -0,0 +1,253 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* BatchRunner Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#include "BatchRunner.h"
+#include "Aircraft.h"
+#include "Category.h"
+#include "Command.h"
+#include "CommandQueue.h"
+#include "World.h"
+
+#include <SFML/System/Clock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace GEX
+{
+	namespace
+	{
+		const sf::Vector2f	VIEW_SIZE(1280.f, 960.f);				// same as the game window
+		const sf::Time		TIME_PER_TICK = sf::seconds(1.f / 60.f);
+		const float			PLAYER_SPEED = 200.f;					// same as PlayerControl
+
+			// what the autopilot picked up from the enemies this tick
+		struct Radar
+		{
+			bool			hasTarget;
+			float			targetX;
+			float			targetY;
+		};
+
+		const char* toString(BatchRunner::Pilot pilot)
+		{
+			return pilot == BatchRunner::Pilot::Scripted ? "scripted" : "auto";
+		}
+
+		Command moveCommand(float vx, float vy)
+		{
+			Command command;
+			command.category = Category::PlayerAircraft;
+			command.action = derivedAction<Aircraft>([vx, vy](Aircraft& aircraft, sf::Time)
+			{
+				aircraft.accelerate(vx, vy);
+			});
+
+			return command;
+		}
+
+		void pushScriptedInput(CommandQueue& commands, std::size_t run, int tick)
+		{
+			// weave side to side; each run gets a different period so the matches differ
+			const int period = 120 + static_cast<int>(run % 8) * 30;
+			commands.push(moveCommand(tick % period < period / 2 ? -PLAYER_SPEED : PLAYER_SPEED, 0.f));
+
+			Command fire;
+			fire.category = Category::PlayerAircraft;
+			fire.action = derivedAction<Aircraft>([tick](Aircraft& aircraft, sf::Time)
+			{
+				aircraft.fire();
+				if (tick % 120 == 0)
+					aircraft.launchMissile();
+			});
+			commands.push(std::move(fire));
+		}
+
+		void pushAutopilotInput(CommandQueue& commands, Radar& radar)
+		{
+			// commands run in the order they are queued, so the scan is done before the pilot reads it
+			radar.hasTarget = false;
+
+			Command scan;
+			scan.category = Category::EnemyAircraft;
+			scan.action = derivedAction<Aircraft>([&radar](Aircraft& enemy, sf::Time)
+			{
+				if (enemy.isDestroyed())
+					return;
+
+				sf::Vector2f position = enemy.getWorldPosition();
+				if (!radar.hasTarget || position.y > radar.targetY)
+				{
+					radar.hasTarget = true;
+					radar.targetX = position.x;
+					radar.targetY = position.y;
+				}
+			});
+			commands.push(std::move(scan));
+
+			Command pilot;
+			pilot.category = Category::PlayerAircraft;
+			pilot.action = derivedAction<Aircraft>([&radar](Aircraft& aircraft, sf::Time)
+			{
+				if (!radar.hasTarget)
+					return;
+
+				float offset = radar.targetX - aircraft.getWorldPosition().x;
+				if (std::abs(offset) > 8.f)
+					aircraft.accelerate(offset < 0.f ? -PLAYER_SPEED : PLAYER_SPEED, 0.f);
+
+				aircraft.fire();
+				aircraft.launchMissile();
+			});
+			commands.push(std::move(pilot));
+		}
+	}
+
+	BatchRunner::BatchRunner(const Settings& settings)
+		: settings_(settings)
+	{}
+
+	std::vector<BatchRunner::Result> BatchRunner::run() const
+	{
+		std::vector<Result> results(settings_.runs);
+		std::atomic<std::size_t> nextRun(0);
+
+		// workers pull the next run until none are left; every World lives and dies on
+		// one thread, which is what the per thread object pools need
+		auto worker = [this, &results, &nextRun]()
+		{
+			for (std::size_t run = nextRun++; run < settings_.runs; run = nextRun++)
+				results[run] = playMatch(run);
+		};
+
+		std::size_t threadCount = std::max<std::size_t>(1, std::min(settings_.threads, settings_.runs));
+		std::vector<std::thread> threads;
+		for (std::size_t i = 0; i < threadCount; ++i)
+			threads.emplace_back(worker);
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		return results;
+	}
+
+	void BatchRunner::writeCsv(std::ostream& out, const std::vector<Result>& results)
+	{
+		out << "run,seed,pilot,survived,reached_end,score,ticks,us_per_tick" << std::endl;
+
+		for (const Result& result : results)
+		{
+			float microsecondsPerTick = result.ticks > 0 ? static_cast<float>(result.elapsed.asMicroseconds()) / result.ticks : 0.f;
+
+			out << result.run << ','
+				<< result.seed << ','
+				<< toString(result.pilot) << ','
+				<< result.survived << ','
+				<< result.reachedEnd << ','
+				<< result.score << ','
+				<< result.ticks << ','
+				<< std::fixed << std::setprecision(2) << microsecondsPerTick << std::endl;
+		}
+	}
+
+	BatchRunner::Result BatchRunner::playMatch(std::size_t run) const
+	{
+		World world(VIEW_SIZE, settings_.seed + run);
+		CommandQueue& commands = world.getCommandQueue();
+		Radar radar = { false, 0.f, 0.f };
+
+		int tick = 0;
+		sf::Clock clock;
+		while (tick < settings_.ticks && world.hasAlivePlayer() && !world.hasPlayerReachedEnd())
+		{
+			if (settings_.pilot == Pilot::Scripted)
+				pushScriptedInput(commands, run, tick);
+			else
+				pushAutopilotInput(commands, radar);
+
+			world.update(TIME_PER_TICK, commands);
+			++tick;
+		}
+
+		Result result;
+		result.run = run;
+		result.seed = world.getSeed();
+		result.pilot = settings_.pilot;
+		result.survived = world.hasAlivePlayer();
+		result.reachedEnd = world.hasPlayerReachedEnd();
+		result.score = world.getScore();
+		result.ticks = tick;
+		result.elapsed = clock.getElapsedTime();
+
+		return result;
+	}
+
+	int runBatch(int argc, char* argv[])
+	{
+		BatchRunner::Settings settings;
+		settings.runs = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 16;
+		settings.ticks = argc > 3 ? std::atoi(argv[3]) : 6000;
+		settings.pilot = argc > 4 && std::string(argv[4]) == "scripted" ? BatchRunner::Pilot::Scripted : BatchRunner::Pilot::Autopilot;
+		std::string path = argc > 5 ? argv[5] : "batch.csv";
+		settings.threads = argc > 6 ? std::strtoul(argv[6], nullptr, 10) : std::max(1u, std::thread::hardware_concurrency());
+		settings.seed = argc > 7 ? std::strtoull(argv[7], nullptr, 10) : 1;
+
+		std::ofstream file(path);
+		if (!file)
+		{
+			std::cerr << "cannot write '" << path << "'" << std::endl;
+			return 1;
+		}
+
+		sf::Clock clock;
+		std::vector<BatchRunner::Result> results = BatchRunner(settings).run();
+		float seconds = clock.getElapsedTime().asSeconds();
+
+		BatchRunner::writeCsv(file, results);
+
+		std::size_t survivors = std::count_if(results.begin(), results.end(), [](const BatchRunner::Result& result) { return result.survived; });
+		std::cout << results.size() << " runs (" << toString(settings.pilot) << ") on " << settings.threads << " threads in "
+			<< std::fixed << std::setprecision(2) << seconds << " s, " << survivors << " survived, results in " << path << std::endl;
+
+		return 0;
+	}
+}
\ No newline at end of file
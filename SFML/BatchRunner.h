@@ -0,0 +1,98 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* BatchRunner Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#pragma once
+
+#include <SFML/System/Time.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace GEX
+{
+	// Plays many independent matches at once, each in its own headless World,
+	// spread over a pool of worker threads. Meant for balance tuning and
+	// regression checks, nothing is drawn.
+	class BatchRunner
+	{
+	public:
+		enum class Pilot
+		{
+			Scripted,		// fixed weave pattern, fires constantly
+			Autopilot		// chases the enemy closest to the bottom of the screen
+		};
+
+		struct Settings
+		{
+			std::size_t		runs;
+			int				ticks;
+			Pilot			pilot;
+			std::size_t		threads;
+			std::uint64_t	seed;		// run n is seeded with seed + n
+		};
+
+		struct Result
+		{
+			std::size_t		run;
+			std::uint64_t	seed;
+			Pilot			pilot;
+			bool			survived;
+			bool			reachedEnd;
+			int				score;
+			int				ticks;
+			sf::Time		elapsed;
+		};
+
+	public:
+		explicit				BatchRunner(const Settings& settings);
+
+			// blocks until every run is done; results are in run order
+		std::vector<Result>		run() const;
+
+		static void				writeCsv(std::ostream& out, const std::vector<Result>& results);
+
+	private:
+		Result					playMatch(std::size_t run) const;
+
+	private:
+		Settings				settings_;
+	};
+
+	// Parses "--batch [runs] [ticks] [scripted|auto] [file.csv] [threads] [seed]", runs the batch and
+	// writes the CSV. Returns the process exit code.
+	int		runBatch(int argc, char* argv[]);
+}
@@ -0,0 +1,1471 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Benchmark Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#include "Benchmark.h"
+#include "AllocationTracker.h"
+#include "Aircraft.h"
+#include "BoxBatch.h"
+#include "BulletNode.h"
+#include "DataTables.h"
+#include "Entity.h"
+#include "ParticleNode.h"
+#include "World.h"
+#include "SceneNode.h"
+#include "SpatialHash.h"
+#include "SweepAndPrune.h"
+#include "SpriteBatch.h"
+#include "Broadphase.h"
+#include "TextureManager.h"
+#include "Category.h"
+#include "CollisionMatrix.h"
+#include "CollisionPairs.h"
+#include "CommandQueue.h"
+#include "NeighbourGrid.h"
+#include "Random.h"
+
+#include <SFML\Graphics\RenderTexture.hpp>
+#include <SFML\System\Clock.hpp>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include <iomanip>
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace GEX
+{
+	namespace
+	{
+		const float BENCHMARK_AREA_WIDTH = 1280.f;
+		const float BENCHMARK_AREA_HEIGHT = 960.f;
+
+		// the most memory the process has held so far, as the OS sees it; unlike the
+		// tracked heap peak it is there in every build, but it never goes back down
+		std::size_t getPeakWorkingSet()
+		{
+#if defined(_WIN32)
+			PROCESS_MEMORY_COUNTERS counters;
+			if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+				return 0;
+
+			return counters.PeakWorkingSetSize;
+#else
+			rusage usage;
+			if (getrusage(RUSAGE_SELF, &usage) != 0)
+				return 0;
+
+			return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+		}
+
+		// Stands in for an entity: fixed world bounds and no texture, so the
+		// benchmarks run without a window or GL context
+		class BoxNode : public SceneNode
+		{
+		public:
+			BoxNode(Category::Type category, sf::FloatRect bounds)
+				: SceneNode(category)
+				, bounds_(bounds)
+			{}
+
+			sf::FloatRect getBoundingBox() const override
+			{
+				return bounds_;
+			}
+
+		private:
+			sf::FloatRect bounds_;
+		};
+
+		// Like ParticleNode and BulletNode: draws, but can't tell where. Counts how
+		// often it was drawn, so a wrongly culled subtree shows up as a short count.
+		class UnboundedNode : public SceneNode
+		{
+		public:
+			UnboundedNode()
+				: SceneNode()
+				, drawCount(0)
+			{}
+
+			sf::FloatRect getDrawBounds() const override
+			{
+				return UNBOUNDED;
+			}
+
+			mutable int drawCount;
+
+		private:
+			void drawCurrent(sf::RenderTarget&, sf::RenderStates) const override
+			{
+				++drawCount;
+			}
+
+			void batchCurrent(SpriteBatch&, sf::RenderStates) const override
+			{
+				++drawCount;
+			}
+		};
+
+		// "  MISMATCH" when an implementation disagrees with its reference, which fails the run
+		const char* verdict(bool matches, bool& passed)
+		{
+			passed = passed && matches;
+			return matches ? "" : "  MISMATCH";
+		}
+
+		// Roughly the mix of a bullet heavy wave: mostly bullets, some aircraft and pickups
+		void buildBoxScene(SceneNode& root, std::size_t count, std::mt19937& rng)
+		{
+			std::uniform_real_distribution<float> x(0.f, BENCHMARK_AREA_WIDTH);
+			std::uniform_real_distribution<float> y(0.f, BENCHMARK_AREA_HEIGHT);
+			std::uniform_int_distribution<int> kind(0, 19);
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				int k = kind(rng);
+				SceneNode::Ptr node;
+
+				if (k < 2)
+					node.reset(new BoxNode(Category::EnemyAircraft, sf::FloatRect(x(rng), y(rng), 84.f, 64.f)));
+				else if (k < 3)
+					node.reset(new BoxNode(Category::Pickup, sf::FloatRect(x(rng), y(rng), 40.f, 40.f)));
+				else
+					node.reset(new BoxNode(Category::AlliedProjectile, sf::FloatRect(x(rng), y(rng), 3.f, 14.f)));
+
+				root.attachChild(std::move(node));
+			}
+		}
+
+		// the category pairs World resolves, without the handlers
+		CollisionMatrix makeCollisionMatrix()
+		{
+			CollisionMatrix matrix;
+			matrix.allow(Category::PlayerAircraft, Category::EnemyAircraft);
+			matrix.allow(Category::PlayerAircraft, Category::Pickup);
+			matrix.allow(Category::PlayerAircraft, Category::EnemyProjectile);
+			matrix.allow(Category::EnemyAircraft, Category::AlliedProjectile);
+
+			return matrix;
+		}
+
+		bool benchmarkBroadphase(std::ostream& out)
+		{
+			bool passed = true;
+
+			out << "broadphase: brute force scene walk vs spatial hash vs sweep and prune (ms per tick)" << std::endl;
+			out << std::setw(10) << "entities"
+				<< std::setw(14) << "brute force"
+				<< std::setw(14) << "spatial hash"
+				<< std::setw(10) << "speedup"
+				<< std::setw(14) << "sweep/prune"
+				<< std::setw(10) << "speedup"
+				<< std::setw(10) << "pairs" << std::endl;
+
+			const std::size_t COUNTS[] = { 100, 1000, 10000 };
+
+			for (std::size_t count : COUNTS)
+			{
+				std::mt19937 rng(1234);
+				SceneNode root;
+				buildBoxScene(root, count, rng);
+
+				const int iterations = count > 1000 ? 2 : 50;
+				const CollisionMatrix matrix = makeCollisionMatrix();
+
+				CollisionPairs brutePairs;
+				sf::Clock clock;
+				for (int i = 0; i < iterations; ++i)
+				{
+					brutePairs.clear();
+					root.checkSceneCollision(root, matrix, brutePairs);
+					brutePairs.build();
+				}
+				float bruteTime = clock.restart().asSeconds() * 1000.f / iterations;
+
+				SpatialHash grid;
+				std::vector<SceneNode*> nodes;
+				CollisionPairs gridPairs;
+				clock.restart();
+				for (int i = 0; i < iterations; ++i)
+				{
+					nodes.clear();
+					root.collectNodes(Category::Aircraft | Category::Projectile | Category::Pickup, nodes);
+
+					grid.clear();
+					for (SceneNode* node : nodes)
+						grid.insert(*node);
+
+					gridPairs.clear();
+					grid.findPairs(matrix, gridPairs);
+				}
+				float gridTime = clock.restart().asSeconds() * 1000.f / iterations;
+
+				// the nodes stand still, so after the first pass its sort has nothing to do,
+				// like a tick where little moved
+				SweepAndPrune sweep;
+				CollisionPairs sweepPairs;
+				clock.restart();
+				for (int i = 0; i < iterations; ++i)
+				{
+					nodes.clear();
+					root.collectNodes(Category::Aircraft | Category::Projectile | Category::Pickup, nodes);
+					sweep.update(nodes);
+
+					sweepPairs.clear();
+					sweep.findPairs(matrix, sweepPairs);
+				}
+				float sweepTime = clock.restart().asSeconds() * 1000.f / iterations;
+
+				out << std::setw(10) << count
+					<< std::setw(14) << std::fixed << std::setprecision(3) << bruteTime
+					<< std::setw(14) << gridTime
+					<< std::setw(9) << std::setprecision(1) << bruteTime / gridTime << "x"
+					<< std::setw(14) << std::setprecision(3) << sweepTime
+					<< std::setw(9) << std::setprecision(1) << bruteTime / sweepTime << "x"
+					<< std::setw(10) << gridPairs.size()
+					<< verdict(gridPairs == brutePairs && sweepPairs == brutePairs, passed) << std::endl;
+			}
+
+			return passed;
+		}
+
+		// Coordinates on a coarse grid, so shared and touching edges are common, and
+		// sizes that can be zero or negative; everything intersects() has to get right
+		sf::FloatRect makeAwkwardRect(std::mt19937& rng)
+		{
+			std::uniform_int_distribution<int> position(0, 160);
+			std::uniform_int_distribution<int> size(-8, 8);
+
+			return sf::FloatRect(position(rng) * 8.f, position(rng) * 6.f, size(rng) * 8.f, size(rng) * 6.f);
+		}
+
+		bool benchmarkBoxes(std::ostream& out)
+		{
+			bool passed = true;
+
+			out << "boxes: one rect against a batch, sf::FloatRect::intersects vs BoxBatch (ns per box)"
+				<< (BoxBatch::isAccelerated() ? "" : " (SSE not available, both kernels are scalar)") << std::endl;
+			out << std::setw(10) << "boxes"
+				<< std::setw(12) << "intersects"
+				<< std::setw(10) << "scalar"
+				<< std::setw(10) << "simd"
+				<< std::setw(10) << "speedup" << std::endl;
+
+			const std::size_t COUNTS[] = { 7, 64, 1000, 10000 };
+
+			for (std::size_t count : COUNTS)
+			{
+				std::mt19937 rng(1234);
+				std::vector<sf::FloatRect> rects(count);
+				BoxBatch boxes;
+				boxes.reserve(count);
+				for (sf::FloatRect& rect : rects)
+				{
+					rect = makeAwkwardRect(rng);
+					boxes.add(rect);
+				}
+
+				std::vector<sf::FloatRect> queries(256);
+				for (sf::FloatRect& query : queries)
+					query = makeAwkwardRect(rng);
+
+				// every query from a few starting indices, against both kernels and the reference
+				bool valid = true;
+				std::vector<std::size_t> expected, scalar, simd;
+				for (const sf::FloatRect& query : queries)
+				{
+					const std::size_t FIRSTS[] = { 0, 1, 3, count / 2, count };
+					for (std::size_t first : FIRSTS)
+					{
+						expected.clear();
+						for (std::size_t i = first; i < count; ++i)
+						{
+							if (query.intersects(rects[i]))
+								expected.push_back(i);
+						}
+
+						scalar.clear();
+						boxes.findOverlapsScalar(query, scalar, first);
+						simd.clear();
+						boxes.findOverlaps(query, simd, first);
+
+						valid = valid && scalar == expected && simd == expected;
+					}
+				}
+
+				const std::size_t ROUNDS = std::max<std::size_t>(4, 16000000 / (count * queries.size()));
+				std::size_t found[3] = { 0, 0, 0 };
+
+				sf::Clock clock;
+				for (std::size_t round = 0; round < ROUNDS; ++round)
+				{
+					for (const sf::FloatRect& query : queries)
+					{
+						for (const sf::FloatRect& rect : rects)
+							found[0] += query.intersects(rect) ? 1 : 0;
+					}
+				}
+				float referenceTime = clock.restart().asSeconds();
+
+				for (std::size_t round = 0; round < ROUNDS; ++round)
+				{
+					for (const sf::FloatRect& query : queries)
+					{
+						scalar.clear();
+						boxes.findOverlapsScalar(query, scalar);
+						found[1] += scalar.size();
+					}
+				}
+				float scalarTime = clock.restart().asSeconds();
+
+				for (std::size_t round = 0; round < ROUNDS; ++round)
+				{
+					for (const sf::FloatRect& query : queries)
+					{
+						simd.clear();
+						boxes.findOverlaps(query, simd);
+						found[2] += simd.size();
+					}
+				}
+				float simdTime = clock.restart().asSeconds();
+
+				const float tests = static_cast<float>(ROUNDS) * queries.size() * count;
+				out << std::setw(10) << count
+					<< std::setw(12) << std::fixed << std::setprecision(2) << referenceTime * 1e9f / tests
+					<< std::setw(10) << scalarTime * 1e9f / tests
+					<< std::setw(10) << simdTime * 1e9f / tests
+					<< std::setw(9) << std::setprecision(1) << referenceTime / simdTime << "x"
+					<< verdict(valid && found[0] == found[1] && found[1] == found[2], passed) << std::endl;
+			}
+
+			return passed;
+		}
+
+		bool benchmarkTables(std::ostream& out)
+		{
+			bool passed = true;
+
+			out << "tables: aircraft data lookup, std::map::at vs enum indexed array (ns per lookup)" << std::endl;
+
+			const AircraftTable table = initializeAircraftData();
+			std::map<Aircraft::Type, AircraftData> map;
+			for (std::size_t i = 0; i < AircraftTable::SIZE; ++i)
+				map[static_cast<Aircraft::Type>(i)] = table[static_cast<Aircraft::Type>(i)];
+
+			// the same random mix of types for both, like a wave of mixed aircraft
+			std::mt19937 rng(1234);
+			std::uniform_int_distribution<int> kind(0, static_cast<int>(AircraftTable::SIZE) - 1);
+			std::vector<Aircraft::Type> types(4096);
+			for (Aircraft::Type& type : types)
+				type = static_cast<Aircraft::Type>(kind(rng));
+
+			const int ROUNDS = 2000;
+
+			float mapSum = 0.f;
+			sf::Clock clock;
+			for (int round = 0; round < ROUNDS; ++round)
+			{
+				for (Aircraft::Type type : types)
+					mapSum += map.at(type).speed + map.at(type).fireInterval.asSeconds();
+			}
+			float mapTime = clock.restart().asSeconds();
+
+			float tableSum = 0.f;
+			clock.restart();
+			for (int round = 0; round < ROUNDS; ++round)
+			{
+				for (Aircraft::Type type : types)
+					tableSum += table[type].speed + table[type].fireInterval.asSeconds();
+			}
+			float tableTime = clock.restart().asSeconds();
+
+			const float lookups = static_cast<float>(ROUNDS) * types.size() * 2.f;
+			out << std::setw(14) << "std::map"
+				<< std::setw(10) << std::fixed << std::setprecision(2) << mapTime * 1e9f / lookups << std::endl;
+			out << std::setw(14) << "EnumTable"
+				<< std::setw(10) << tableTime * 1e9f / lookups
+				<< verdict(mapSum == tableSum, passed) << std::endl;
+
+			return passed;
+		}
+
+		// An entity with nothing to draw, standing in for the bullets and aircraft of a layer
+		class WreckNode : public Entity
+		{
+		public:
+			WreckNode()
+				: Entity(1)
+			{}
+
+			unsigned int getCategory() const override
+			{
+				return Category::EnemyAircraft;
+			}
+		};
+
+		bool benchmarkWrecks(std::ostream& out)
+		{
+			bool passed = true;
+
+			out << "wrecks: removeWrecks() on an idle tick vs a tick that destroys a share of the nodes (us per pass)" << std::endl;
+			out << std::setw(10) << "nodes"
+				<< std::setw(10) << "idle"
+				<< std::setw(12) << "1% dead"
+				<< std::setw(12) << "50% dead" << std::endl;
+
+			const std::size_t COUNTS[] = { 1000, 10000, 100000 };
+			const std::size_t LAYERS = 4;
+
+			for (std::size_t count : COUNTS)
+			{
+				float times[3];
+				bool valid = true;
+				const std::size_t STRIDES[] = { 0, 100, 2 };
+
+				for (int run = 0; run < 3; ++run)
+				{
+					SceneNode root;
+					std::vector<Entity*> entities;
+					for (std::size_t layer = 0; layer < LAYERS; ++layer)
+					{
+						SceneNode::Ptr node(new SceneNode());
+						for (std::size_t i = 0; i < count / LAYERS; ++i)
+						{
+							std::unique_ptr<WreckNode> entity(new WreckNode());
+							entities.push_back(entity.get());
+							node->attachChild(std::move(entity));
+						}
+						root.attachChild(std::move(node));
+					}
+
+					std::size_t destroyed = 0;
+					if (STRIDES[run] > 0)
+					{
+						for (std::size_t i = 0; i < entities.size(); i += STRIDES[run])
+						{
+							entities[i]->destroy();
+							++destroyed;
+						}
+					}
+
+					const int iterations = run == 0 ? 1000 : 1;
+					sf::Clock clock;
+					for (int i = 0; i < iterations; ++i)
+						root.removeWrecks();
+					times[run] = clock.restart().asSeconds() * 1e6f / iterations;
+
+					std::vector<SceneNode*> survivors;
+					root.collectNodes(Category::EnemyAircraft, survivors);
+					valid = valid && survivors.size() == entities.size() - destroyed;
+				}
+
+				out << std::setw(10) << count
+					<< std::setw(10) << std::fixed << std::setprecision(2) << times[0]
+					<< std::setw(12) << times[1]
+					<< std::setw(12) << times[2]
+					<< verdict(valid, passed) << std::endl;
+			}
+
+			return passed;
+		}
+
+		bool benchmarkGuidance(std::ostream& out)
+		{
+			bool passed = true;
+
+			out << "guidance: nearest enemy per missile, linear distance() scan vs neighbour grid (ms per tick)" << std::endl;
+			out << std::setw(10) << "missiles"
+				<< std::setw(10) << "enemies"
+				<< std::setw(12) << "linear"
+				<< std::setw(12) << "grid"
+				<< std::setw(10) << "speedup" << std::endl;
+
+			const std::size_t COUNTS[][2] = { { 20, 50 }, { 200, 500 }, { 1000, 2000 } };
+
+			for (const auto& count : COUNTS)
+			{
+				std::mt19937 rng(1234);
+				std::uniform_real_distribution<float> x(0.f, BENCHMARK_AREA_WIDTH);
+				std::uniform_real_distribution<float> y(0.f, BENCHMARK_AREA_HEIGHT);
+
+				// missiles and enemies sit one level below the root, like in the air layer
+				SceneNode root;
+				SceneNode* layer = new SceneNode();
+				root.attachChild(SceneNode::Ptr(layer));
+
+				std::vector<SceneNode*> missiles;
+				std::vector<SceneNode*> enemies;
+				for (std::size_t i = 0; i < count[0] + count[1]; ++i)
+				{
+					SceneNode* node = new SceneNode();
+					node->setPosition(x(rng), y(rng));
+					layer->attachChild(SceneNode::Ptr(node));
+					(i < count[0] ? missiles : enemies).push_back(node);
+				}
+
+				const int iterations = 20;
+
+				std::vector<SceneNode*> linearTargets(missiles.size());
+				sf::Clock clock;
+				for (int i = 0; i < iterations; ++i)
+				{
+					for (std::size_t m = 0; m < missiles.size(); ++m)
+					{
+						float minDistance = std::numeric_limits<float>::max();
+						for (SceneNode* enemy : enemies)
+						{
+							float d = distance(*missiles[m], *enemy);
+							if (d < minDistance)
+							{
+								minDistance = d;
+								linearTargets[m] = enemy;
+							}
+						}
+					}
+				}
+				float linearTime = clock.restart().asSeconds() * 1000.f / iterations;
+
+				NeighbourGrid grid;
+				std::vector<SceneNode*> gridTargets(missiles.size());
+				clock.restart();
+				for (int i = 0; i < iterations; ++i)
+				{
+					grid.clear();
+					for (SceneNode* enemy : enemies)
+						grid.insert(*enemy, enemy->getWorldPosition());
+					grid.build();
+
+					for (std::size_t m = 0; m < missiles.size(); ++m)
+						gridTargets[m] = grid.findNearest(missiles[m]->getWorldPosition());
+				}
+				float gridTime = clock.restart().asSeconds() * 1000.f / iterations;
+
+				out << std::setw(10) << count[0]
+					<< std::setw(10) << count[1]
+					<< std::setw(12) << std::fixed << std::setprecision(3) << linearTime
+					<< std::setw(12) << gridTime
+					<< std::setw(9) << std::setprecision(1) << linearTime / gridTime << "x"
+					<< verdict(gridTargets == linearTargets, passed) << std::endl;
+			}
+
+			return passed;
+		}
+
+		// Enough commands per frame to cover input, AI and the missile guider
+		const std::size_t COMMANDS_PER_FRAME = 32;
+		const int COMMAND_FRAMES = 100000;
+
+		Command makeBenchmarkCommand(int& counter)
+		{
+			Command command;
+			command.category = Category::PlayerAircraft;
+			command.action = [&counter](SceneNode&, sf::Time)
+			{
+				++counter;
+			};
+			return command;
+		}
+
+		bool benchmarkCommandQueue(std::ostream& out)
+		{
+			bool passed = true;
+
+			out << "commandqueue: std::queue vs ring buffer (ns per command)" << std::endl;
+
+			SceneNode node;
+			const sf::Time dt = sf::seconds(1.f / 60.f);
+
+			int queueCount = 0;
+			std::queue<Command> queue;
+			sf::Clock clock;
+			for (int frame = 0; frame < COMMAND_FRAMES; ++frame)
+			{
+				for (std::size_t i = 0; i < COMMANDS_PER_FRAME; ++i)
+					queue.push(makeBenchmarkCommand(queueCount));
+
+				while (!queue.empty())
+				{
+					queue.front().action(node, dt);
+					queue.pop();
+				}
+			}
+			float queueTime = clock.restart().asSeconds();
+
+			int ringCount = 0;
+			CommandQueue ring;
+			clock.restart();
+			for (int frame = 0; frame < COMMAND_FRAMES; ++frame)
+			{
+				for (std::size_t i = 0; i < COMMANDS_PER_FRAME; ++i)
+					ring.push(makeBenchmarkCommand(ringCount));
+
+				ring.drain([&node, dt](const Command& command)
+				{
+					command.action(node, dt);
+				});
+			}
+			float ringTime = clock.restart().asSeconds();
+
+			const float commands = static_cast<float>(COMMAND_FRAMES * COMMANDS_PER_FRAME);
+			out << std::setw(14) << "std::queue"
+				<< std::setw(10) << std::fixed << std::setprecision(1) << queueTime * 1e9f / commands << std::endl;
+			out << std::setw(14) << "ring buffer"
+				<< std::setw(10) << ringTime * 1e9f / commands
+				<< "  (capacity " << ring.getCapacity() << ")"
+				<< verdict(queueCount == ringCount, passed) << std::endl;
+
+			return passed;
+		}
+
+		void spawnBenchmarkBullet(BulletNode& bullets, std::mt19937& rng)
+		{
+			std::uniform_real_distribution<float> x(0.f, BENCHMARK_AREA_WIDTH);
+			std::uniform_real_distribution<float> y(0.f, BENCHMARK_AREA_HEIGHT);
+			std::uniform_int_distribution<int> side(0, 1);
+
+			// half the screen shooting up, half shooting down
+			if (side(rng) == 0)
+				bullets.addBullet(Projectile::Type::AlliedBullet, sf::Vector2f(x(rng), y(rng)), sf::Vector2f(0.f, -300.f));
+			else
+				bullets.addBullet(Projectile::Type::EnemyBullet, sf::Vector2f(x(rng), y(rng)), sf::Vector2f(0.f, 300.f));
+		}
+
+		void benchmarkBullets(std::ostream& out)
+		{
+			out << "bullets: BulletNode tick at a steady population (ms per frame, 16.7 available)" << std::endl;
+			out << std::setw(10) << "bullets"
+				<< std::setw(12) << "simulate"
+				<< std::setw(12) << "collide"
+				<< std::setw(12) << "draw"
+				<< std::setw(12) << "total"
+				<< std::setw(10) << "hits" << std::endl;
+
+			TextureManager textures;
+			textures.load(TextureID::Entities, "Media/Textures/Entities.png");
+
+			sf::RenderTexture target;
+			target.create(static_cast<unsigned int>(BENCHMARK_AREA_WIDTH), static_cast<unsigned int>(BENCHMARK_AREA_HEIGHT));
+
+			const sf::FloatRect area(0.f, 0.f, BENCHMARK_AREA_WIDTH, BENCHMARK_AREA_HEIGHT);
+			const sf::Time dt = sf::seconds(1.f / 60.f);
+			const std::size_t COUNTS[] = { 10000, 50000, 100000 };
+			const int FRAMES = 120;
+
+			for (std::size_t count : COUNTS)
+			{
+				std::mt19937 rng(1234);
+				SceneNode root;
+
+				// a wave of aircraft for the bullets to run into
+				SceneNode targets;
+				buildBoxScene(targets, 40, rng);
+
+				SpatialHash grid;
+				std::vector<SceneNode*> nodes;
+				targets.collectNodes(Category::Aircraft, nodes);
+				for (SceneNode* node : nodes)
+					grid.insert(*node);
+
+				std::unique_ptr<BulletNode> bulletNode(new BulletNode(textures));
+				BulletNode& bullets = *bulletNode;
+				root.attachChild(std::move(bulletNode));
+
+				CommandQueue commands;
+				std::size_t hits = 0;
+				auto onHit = [&hits](SceneNode&, int) { ++hits; };
+
+				sf::Time simulateTime, collideTime, drawTime;
+				sf::Clock clock;
+
+				for (int frame = 0; frame < FRAMES; ++frame)
+				{
+					// replace whatever left the screen or hit something last frame
+					clock.restart();
+					while (bullets.getBulletCount() < count)
+						spawnBenchmarkBullet(bullets, rng);
+
+					root.update(dt, commands);
+					bullets.removeOutside(area);
+					simulateTime += clock.restart();
+
+					bullets.checkCollisions(grid, onHit);
+					collideTime += clock.restart();
+
+					target.clear();
+					target.draw(root);
+					target.display();
+					drawTime += clock.restart();
+				}
+
+				float simulate = simulateTime.asSeconds() * 1000.f / FRAMES;
+				float collide = collideTime.asSeconds() * 1000.f / FRAMES;
+				float draw = drawTime.asSeconds() * 1000.f / FRAMES;
+
+				out << std::setw(10) << count
+					<< std::setw(12) << std::fixed << std::setprecision(3) << simulate
+					<< std::setw(12) << collide
+					<< std::setw(12) << draw
+					<< std::setw(12) << simulate + collide + draw
+					<< std::setw(10) << hits << std::endl;
+			}
+		}
+
+		// ParticleNode as it was before the arrays: a deque of particles, a table
+		// lookup per particle and one VertexArray::append per vertex
+		class LegacyParticleNode : public SceneNode
+		{
+		public:
+			LegacyParticleNode(Particle::Type type, const TextureManager& textures)
+				: texture_(textures.get(TextureID::Particle))
+				, type_(type)
+				, table_(initializeParticleData())
+				, vertexArray_(sf::Quads)
+				, needsVertexUpdate_(true)
+			{}
+
+			void addParticle(sf::Vector2f position)
+			{
+				Particle particle;
+
+				particle.position = position;
+				particle.color = table_[type_].color;
+				particle.lifetime = table_[type_].lifetime;
+
+				particles_.push_back(particle);
+			}
+
+		private:
+			void updateCurrent(sf::Time dt, CommandQueue& commands) override
+			{
+				while (!particles_.empty() && particles_.front().lifetime <= sf::Time::Zero)
+					particles_.pop_front();
+
+				for (Particle& p : particles_)
+					p.lifetime -= dt;
+
+				needsVertexUpdate_ = true;
+			}
+
+			void drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override
+			{
+				if (needsVertexUpdate_)
+				{
+					computeVertices();
+					needsVertexUpdate_ = false;
+				}
+
+				states.texture = &texture_;
+				target.draw(vertexArray_, states);
+			}
+
+			void addVertex(float worldX, float worldY, float texCoordU, float texCoordV, const sf::Color color) const
+			{
+				sf::Vertex vertex;
+
+				vertex.position = sf::Vector2f(worldX, worldY);
+				vertex.texCoords = sf::Vector2f(texCoordU, texCoordV);
+				vertex.color = color;
+
+				vertexArray_.append(vertex);
+			}
+
+			void computeVertices() const
+			{
+				sf::Vector2f size(texture_.getSize());
+				sf::Vector2f half = size / 2.f;
+
+				vertexArray_.clear();
+				for (const Particle& p : particles_)
+				{
+					sf::Vector2f pos = p.position;
+					sf::Color color = p.color;
+
+					float ratio = p.lifetime.asSeconds() / table_[type_].lifetime.asSeconds();
+					color.a = static_cast<sf::Uint8>(255 * std::max(ratio, 0.f));
+
+					addVertex(pos.x - half.x, pos.y - half.y, 0.f, 0.f, color);
+					addVertex(pos.x + half.x, pos.y - half.y, size.x, 0.f, color);
+					addVertex(pos.x + half.x, pos.y + half.y, size.x, size.y, color);
+					addVertex(pos.x - half.x, pos.y + half.y, 0.f, size.y, color);
+				}
+			}
+
+		private:
+			std::deque<Particle>						particles_;
+			const sf::Texture&							texture_;
+			Particle::Type								type_;
+			ParticleTable								table_;
+
+			mutable sf::VertexArray						vertexArray_;
+			mutable bool								needsVertexUpdate_;
+		};
+
+		// Emits enough smoke per frame to hold count particles alive, then times
+		// update plus vertex generation once the population has settled
+		template <typename Node>
+		float timeParticles(Node& node, std::size_t count, sf::RenderTarget& target)
+		{
+			const sf::Time dt = sf::seconds(1.f / 60.f);
+			const int framesPerLifetime = static_cast<int>(initializeParticleData()[Particle::Type::Smoke].lifetime / dt);
+			const std::size_t perFrame = count / framesPerLifetime;
+
+			std::mt19937 rng(1234);
+			std::uniform_real_distribution<float> x(0.f, BENCHMARK_AREA_WIDTH);
+			std::uniform_real_distribution<float> y(0.f, BENCHMARK_AREA_HEIGHT);
+
+			CommandQueue commands;
+			sf::Clock clock;
+			sf::Time elapsed;
+
+			for (int frame = 0; frame < 2 * framesPerLifetime; ++frame)
+			{
+				for (std::size_t i = 0; i < perFrame; ++i)
+					node.addParticle(sf::Vector2f(x(rng), y(rng)));
+
+				clock.restart();
+				node.update(dt, commands);
+				target.draw(node);
+
+				// the first lifetime only fills the system
+				if (frame >= framesPerLifetime)
+					elapsed += clock.getElapsedTime();
+			}
+
+			return elapsed.asSeconds() * 1000.f / framesPerLifetime;
+		}
+
+		void benchmarkParticles(std::ostream& out)
+		{
+			out << "particles: deque ParticleNode vs ring buffer arrays (ms per frame, update + vertices)" << std::endl;
+			out << std::setw(10) << "particles"
+				<< std::setw(12) << "deque"
+				<< std::setw(12) << "arrays"
+				<< std::setw(10) << "speedup" << std::endl;
+
+			TextureManager textures;
+			textures.load(TextureID::Particle, "Media/Textures/Particle.png");
+
+			sf::RenderTexture target;
+			target.create(static_cast<unsigned int>(BENCHMARK_AREA_WIDTH), static_cast<unsigned int>(BENCHMARK_AREA_HEIGHT));
+
+			const std::size_t COUNTS[] = { 10000, 100000 };
+
+			for (std::size_t count : COUNTS)
+			{
+				LegacyParticleNode legacy(Particle::Type::Smoke, textures);
+				float legacyTime = timeParticles(legacy, count, target);
+
+				ParticleNode particles(Particle::Type::Smoke, textures);
+				float arrayTime = timeParticles(particles, count, target);
+
+				out << std::setw(10) << particles.getParticleCount()
+					<< std::setw(12) << std::fixed << std::setprecision(3) << legacyTime
+					<< std::setw(12) << arrayTime
+					<< std::setw(9) << std::setprecision(1) << legacyTime / arrayTime << "x" << std::endl;
+			}
+		}
+
+		void benchmarkHeadlessWorld(std::ostream& out)
+		{
+			out << "headless: World simulation without a window, player firing every tick" << std::endl;
+
+			World world(sf::Vector2f(BENCHMARK_AREA_WIDTH, BENCHMARK_AREA_HEIGHT), 1);
+			const sf::Time dt = sf::seconds(1.f / 60.f);
+			const int TICKS = 6000;
+
+			Command fire;
+			fire.category = Category::PlayerAircraft;
+			fire.action = derivedAction<Aircraft>([](Aircraft& aircraft, sf::Time)
+			{
+				aircraft.fire();
+			});
+
+			int ticks = 0;
+			sf::Clock clock;
+			while (ticks < TICKS && world.hasAlivePlayer() && !world.hasPlayerReachedEnd())
+			{
+				world.getCommandQueue().push(fire.clone());
+				world.update(dt, world.getCommandQueue());
+				++ticks;
+			}
+			float seconds = clock.getElapsedTime().asSeconds();
+
+			out << std::setw(10) << ticks << " ticks"
+				<< std::setw(12) << std::fixed << std::setprecision(0) << ticks / seconds << " ticks/s"
+				<< std::setw(10) << std::setprecision(1) << ticks * dt.asSeconds() / seconds << "x realtime" << std::endl;
+		}
+
+		// weaves side to side, fires every tick and launches a missile every two seconds;
+		// the fire action captures the tick, so every command is a fresh closure
+		void pushCommandScript(CommandQueue& commands, int tick)
+		{
+			const float speed = tick % 240 < 120 ? -200.f : 200.f;
+
+			Command move;
+			move.category = Category::PlayerAircraft;
+			move.action = derivedAction<Aircraft>([speed](Aircraft& aircraft, sf::Time)
+			{
+				aircraft.accelerate(speed, 0.f);
+			});
+			commands.push(std::move(move));
+
+			Command fire;
+			fire.category = Category::PlayerAircraft;
+			fire.action = derivedAction<Aircraft>([tick](Aircraft& aircraft, sf::Time)
+			{
+				aircraft.fire();
+				if (tick % 120 == 0)
+					aircraft.launchMissile();
+			});
+			commands.push(std::move(fire));
+		}
+
+		bool benchmarkCommandAllocations(std::ostream& out)
+		{
+			out << "commandalloc: heap allocations in command dispatch and drain, scripted 60 s headless run" << std::endl;
+
+			if (!AllocationTracker::isEnabled())
+			{
+				out << "    NOT MEASURED, allocation tracking is compiled out; build the Benchmark configuration" << std::endl;
+				return false;
+			}
+
+			World world(sf::Vector2f(BENCHMARK_AREA_WIDTH, BENCHMARK_AREA_HEIGHT), 1);
+			CommandQueue& commands = world.getCommandQueue();
+			const sf::Time dt = sf::seconds(1.f / 60.f);
+			const int TICKS = 60 * 60;
+
+			std::size_t dispatchAllocations = 0;
+			std::size_t drainAllocations = 0;
+			std::size_t otherAllocations = 0;
+			int failedFrames = 0;
+			int firstFailedFrame = -1;
+
+			int ticks = 0;
+			while (ticks < TICKS && world.hasAlivePlayer() && !world.hasPlayerReachedEnd())
+			{
+				// a frame for the script's pushes, then one for the update that drains them
+				AllocationTracker::endFrame();
+				pushCommandScript(commands, ticks);
+				AllocationTracker::endFrame();
+				const std::size_t dispatched = AllocationTracker::getLastFrame().allocations;
+
+				const std::size_t drainedBefore = AllocationTracker::getInclusiveScope("World::drainCommands").allocations;
+				world.update(dt, commands);
+				AllocationTracker::endFrame();
+				const std::size_t drained = AllocationTracker::getInclusiveScope("World::drainCommands").allocations - drainedBefore;
+
+				dispatchAllocations += dispatched;
+				drainAllocations += drained;
+				otherAllocations += AllocationTracker::getLastFrame().allocations - drained;
+
+				if (dispatched + drained > 0)
+				{
+					if (firstFailedFrame < 0)
+						firstFailedFrame = ticks;
+					++failedFrames;
+				}
+
+				++ticks;
+			}
+
+			out << std::setw(10) << "ticks"
+				<< std::setw(12) << "dispatch"
+				<< std::setw(12) << "drain"
+				<< std::setw(12) << "elsewhere"
+				<< std::setw(12) << "capacity" << std::endl;
+			out << std::setw(10) << ticks
+				<< std::setw(12) << dispatchAllocations
+				<< std::setw(12) << drainAllocations
+				<< std::setw(12) << otherAllocations
+				<< std::setw(12) << commands.getCapacity();
+
+			if (failedFrames > 0)
+				out << "  ALLOCATES in " << failedFrames << " frames, first at tick " << firstFailedFrame;
+			out << std::endl;
+
+			return failedFrames == 0;
+		}
+
+		bool benchmarkCulling(std::ostream& out)
+		{
+			bool passed = true;
+
+			const int GROUPS = 2000;
+			const int FRAMES = 200;
+
+			out << "culling: " << GROUPS << " groups of two boxes, half off-screen, some holding a node of unknown bounds" << std::endl;
+
+			// even groups on screen, odd ones to the right of it; every other off-screen
+			// group also holds an unbounded node, which must be drawn all the same
+			SceneNode root;
+			std::vector<const UnboundedNode*> unbounded;
+			int expectedCulled = 0;
+			for (int i = 0; i < GROUPS; ++i)
+			{
+				const bool onScreen = i % 2 == 0;
+				const float x = onScreen ? static_cast<float>(i % 40) * 30.f : BENCHMARK_AREA_WIDTH + 100.f + static_cast<float>(i) * 30.f;
+				const sf::FloatRect bounds(x, static_cast<float>(i / 40) * 18.f, 24.f, 16.f);
+
+				std::unique_ptr<BoxNode> group(new BoxNode(Category::None, bounds));
+				group->attachChild(SceneNode::Ptr(new BoxNode(Category::None, bounds)));
+				if (!onScreen)
+					expectedCulled += 2;
+
+				if (i % 4 == 1)
+				{
+					std::unique_ptr<UnboundedNode> node(new UnboundedNode());
+					unbounded.push_back(node.get());
+					group->attachChild(std::move(node));
+				}
+
+				root.attachChild(std::move(group));
+			}
+			root.updateDrawBounds();
+
+			const sf::FloatRect viewBounds(0.f, 0.f, BENCHMARK_AREA_WIDTH, BENCHMARK_AREA_HEIGHT);
+			sf::RenderTexture target;
+			target.create(static_cast<unsigned int>(BENCHMARK_AREA_WIDTH), static_cast<unsigned int>(BENCHMARK_AREA_HEIGHT));
+			target.setView(sf::View(viewBounds));
+			SpriteBatch batch;
+
+			out << std::setw(10) << "path"
+				<< std::setw(12) << "ms/frame"
+				<< std::setw(10) << "drawn"
+				<< std::setw(10) << "culled"
+				<< std::setw(12) << "unbounded" << std::endl;
+
+			for (int batched = 0; batched < 2; ++batched)
+			{
+				for (const UnboundedNode* node : unbounded)
+					node->drawCount = 0;
+				SceneNode::resetDrawStatistics();
+
+				sf::Clock clock;
+				for (int frame = 0; frame < FRAMES; ++frame)
+				{
+					if (batched)
+					{
+						root.drawBatched(batch, sf::RenderStates::Default, viewBounds);
+						batch.flush(target);
+					}
+					else
+					{
+						target.draw(root);
+					}
+				}
+				float seconds = clock.getElapsedTime().asSeconds();
+
+				int drawCount = 0;
+				for (const UnboundedNode* node : unbounded)
+					drawCount += node->drawCount;
+
+				SceneNode::DrawStatistics statistics = SceneNode::getDrawStatistics();
+				const int expectedCount = static_cast<int>(unbounded.size()) * FRAMES;
+
+				out << std::setw(10) << (batched ? "batched" : "draw")
+					<< std::setw(12) << std::fixed << std::setprecision(3) << seconds * 1000.f / FRAMES
+					<< std::setw(10) << statistics.drawn / FRAMES
+					<< std::setw(10) << statistics.culled / FRAMES
+					<< std::setw(12) << drawCount / FRAMES << "/" << unbounded.size()
+					<< verdict(drawCount == expectedCount && statistics.culled == static_cast<std::size_t>(expectedCulled) * FRAMES, passed)
+					<< std::endl;
+			}
+
+			return passed;
+		}
+
+		// A headless World played from a fixed seed for a fixed number of ticks, so runs
+		// of the same build are comparable. setup runs once, input before every tick.
+		struct Scenario
+		{
+			const char*										name;
+			int												ticks;
+			std::function<void(World&)>						setup;
+			std::function<void(CommandQueue&, int)>			input;
+		};
+
+		Command playerCommand(std::function<void(Aircraft&)> action)
+		{
+			Command command;
+			command.category = Category::PlayerAircraft;
+			command.action = derivedAction<Aircraft>([action](Aircraft& aircraft, sf::Time)
+			{
+				action(aircraft);
+			});
+
+			return command;
+		}
+
+		// tops the player up every tick, so the scenario runs its full length
+		void keepPlayerAlive(CommandQueue& commands)
+		{
+			commands.push(playerCommand([](Aircraft& aircraft)
+			{
+				if (aircraft.getHitpoints() < 5000)
+					aircraft.repair(5000);
+			}));
+		}
+
+		std::vector<Scenario> makeScenarios()
+		{
+			std::vector<Scenario> scenarios;
+
+			// the default level, player at full fire rate and spread, holding the trigger
+			scenarios.push_back(Scenario{ "firespread", 1200,
+				[](World&) {},
+				[](CommandQueue& commands, int tick)
+				{
+					if (tick == 0)
+					{
+						commands.push(playerCommand([](Aircraft& aircraft)
+						{
+							for (int i = 0; i < 10; ++i)
+							{
+								aircraft.increaseFireRate();
+								aircraft.increaseFireSpread();
+							}
+						}));
+					}
+
+					commands.push(playerCommand([](Aircraft& aircraft) { aircraft.fire(); }));
+					keepPlayerAlive(commands);
+				} });
+
+			// 500 Raptors and Avengers on screen at once, all of them firing
+			scenarios.push_back(Scenario{ "enemies500", 600,
+				[](World& world)
+				{
+					for (int i = 0; i < 500; ++i)
+					{
+						Aircraft::Type type = i % 2 == 0 ? Aircraft::Type::Raptor : Aircraft::Type::Avenger;
+						world.addEnemy(type, -600.f + (i % 25) * 50.f, 80.f + (i / 25) * 24.f);
+					}
+				},
+				[](CommandQueue& commands, int)
+				{
+					keepPlayerAlive(commands);
+				} });
+
+			// a missile a tick for 100 ticks, all guided towards a far away squadron
+			scenarios.push_back(Scenario{ "missiles100", 600,
+				[](World& world)
+				{
+					for (int i = 0; i < 20; ++i)
+						world.addEnemy(i % 2 == 0 ? Aircraft::Type::Raptor : Aircraft::Type::Avenger, -475.f + i * 50.f, 1200.f + (i % 4) * 60.f);
+				},
+				[](CommandQueue& commands, int tick)
+				{
+					if (tick == 0)
+						commands.push(playerCommand([](Aircraft& aircraft) { aircraft.collectMissiles(100); }));
+
+					if (tick < 100)
+						commands.push(playerCommand([](Aircraft& aircraft) { aircraft.launchMissile(); }));
+
+					keepPlayerAlive(commands);
+				} });
+
+			// every particle system gets 400 new particles a tick, far more than the budget allows
+			scenarios.push_back(Scenario{ "particles", 600,
+				[](World&) {},
+				[](CommandQueue& commands, int tick)
+				{
+					Command flood;
+					flood.category = Category::ParticleSystem;
+					flood.action = derivedAction<ParticleNode>([tick](ParticleNode& particles, sf::Time)
+					{
+						Random random(static_cast<std::uint64_t>(tick));
+						for (int i = 0; i < 400; ++i)
+							particles.addParticle(sf::Vector2f(random.nextFloat() * BENCHMARK_AREA_WIDTH, 4040.f + random.nextFloat() * BENCHMARK_AREA_HEIGHT));
+					});
+
+					commands.push(std::move(flood));
+					keepPlayerAlive(commands);
+				} });
+
+			return scenarios;
+		}
+
+		struct ScenarioRun
+		{
+			int				ticks;
+			float			seconds;
+			int				score;
+		};
+
+		// builds the scenario's World on the given broadphase and plays it until it ends or
+		// the player dies; onStart runs once the World is set up, right before the clock starts
+		ScenarioRun runScenario(const Scenario& scenario, Broadphase::Type broadphase, const std::function<void()>& onStart)
+		{
+			const sf::Time dt = sf::seconds(1.f / 60.f);
+
+			World world(sf::Vector2f(BENCHMARK_AREA_WIDTH, BENCHMARK_AREA_HEIGHT), 1);
+			world.setBroadphase(broadphase);
+			scenario.setup(world);
+
+			onStart();
+
+			int ticks = 0;
+			sf::Clock clock;
+			while (ticks < scenario.ticks && world.hasAlivePlayer())
+			{
+				scenario.input(world.getCommandQueue(), ticks);
+				world.update(dt, world.getCommandQueue());
+				++ticks;
+			}
+			float seconds = clock.getElapsedTime().asSeconds();
+
+			return ScenarioRun{ ticks, seconds, world.getScore() };
+		}
+
+		void benchmarkScenarios(std::ostream& out, std::ostream* csv)
+		{
+			out << "scenarios: headless World stress tests, seed 1"
+				<< (AllocationTracker::isEnabled() ? "" : " (build the Benchmark configuration for allocation counts)") << std::endl;
+			out << std::setw(14) << "scenario"
+				<< std::setw(8) << "ticks"
+				<< std::setw(12) << "ticks/s"
+				<< std::setw(10) << "culled"
+				<< std::setw(14) << "allocs/tick"
+				<< std::setw(12) << "heap KB"
+				<< std::setw(14) << "process KB" << std::endl;
+
+			if (csv)
+				*csv << "scenario,ticks,ticks_per_second,particles_culled,allocations_per_tick,peak_heap_bytes,peak_working_set_bytes" << std::endl;
+
+			for (const Scenario& scenario : makeScenarios())
+			{
+				// the World itself is built before counting starts
+				AllocationTracker::Statistics before = {};
+				ScenarioRun run = runScenario(scenario, Broadphase::Type::SweepAndPrune, [&before]()
+				{
+					AllocationTracker::resetPeak();
+					before = AllocationTracker::getStatistics();
+					ParticleBudget::resetStatistics();
+				});
+
+				AllocationTracker::Statistics after = AllocationTracker::getStatistics();
+				std::size_t culled = ParticleBudget::getStatistics().culled;
+				std::size_t workingSet = getPeakWorkingSet();
+				float ticksPerSecond = run.ticks / run.seconds;
+				float allocationsPerTick = static_cast<float>(after.allocations - before.allocations) / run.ticks;
+
+				out << std::setw(14) << scenario.name
+					<< std::setw(8) << run.ticks
+					<< std::setw(12) << std::fixed << std::setprecision(0) << ticksPerSecond
+					<< std::setw(10) << culled;
+
+				if (AllocationTracker::isEnabled())
+					out << std::setw(14) << std::setprecision(1) << allocationsPerTick
+						<< std::setw(12) << after.peakBytesInUse / 1024;
+				else
+					out << std::setw(14) << "-" << std::setw(12) << "-";
+				out << std::setw(14) << workingSet / 1024 << std::endl;
+
+				// untracked builds leave the allocation columns empty rather than report zero
+				if (csv)
+				{
+					*csv << scenario.name << ',' << run.ticks << ',' << std::fixed << std::setprecision(1) << ticksPerSecond << ',' << culled << ',';
+					if (AllocationTracker::isEnabled())
+						*csv << std::setprecision(2) << allocationsPerTick << ',' << after.peakBytesInUse;
+					else
+						*csv << ',';
+					*csv << ',' << workingSet << std::endl;
+				}
+			}
+		}
+
+		// the stress scenarios once per broadphase; all of them must play out the same
+		bool benchmarkBroadphaseScenarios(std::ostream& out)
+		{
+			bool passed = true;
+
+			const Broadphase::Type TYPES[] = { Broadphase::Type::BruteForce, Broadphase::Type::SpatialHash, Broadphase::Type::SweepAndPrune };
+
+			out << "broadphases: stress scenarios per broadphase (ticks per second)" << std::endl;
+			out << std::setw(14) << "scenario";
+			for (Broadphase::Type type : TYPES)
+				out << std::setw(18) << Broadphase::getName(type);
+			out << std::endl;
+
+			for (const Scenario& scenario : makeScenarios())
+			{
+				out << std::setw(14) << scenario.name;
+
+				bool valid = true;
+				int firstScore = 0;
+
+				for (Broadphase::Type type : TYPES)
+				{
+					ScenarioRun run = runScenario(scenario, type, []() {});
+
+					if (type == TYPES[0])
+						firstScore = run.score;
+					valid = valid && run.score == firstScore;
+
+					out << std::setw(18) << std::fixed << std::setprecision(0) << run.ticks / run.seconds;
+				}
+
+				out << verdict(valid, passed) << std::endl;
+			}
+
+			return passed;
+		}
+	}
+
+	int runBenchmarks(const std::string& name, const std::string& csvPath)
+	{
+		bool ran = false;
+		bool passed = true;
+
+		if (name == "all" || name == "broadphase")
+		{
+			passed = benchmarkBroadphase(std::cout) && passed;
+			ran = true;
+		}
+
+		if (name == "all" || name == "boxes")
+		{
+			passed = benchmarkBoxes(std::cout) && passed;
+			ran = true;
+		}
+
+		if (name == "all" || name == "tables")
+		{
+			passed = benchmarkTables(std::cout) && passed;
+			ran = true;
+		}
+
+		if (name == "all" || name == "wrecks")
+		{
+			passed = benchmarkWrecks(std::cout) && passed;
+			ran = true;
+		}
+
+		if (name == "all" || name == "guidance")
+		{
+			passed = benchmarkGuidance(std::cout) && passed;
+			ran = true;
+		}
+
+		if (name == "all" || name == "commandqueue")
+		{
+			passed = benchmarkCommandQueue(std::cout) && passed;
+			ran = true;
+		}
+
+		if (name == "all" || name == "bullets")
+		{
+			benchmarkBullets(std::cout);
+			ran = true;
+		}
+
+		if (name == "all" || name == "particles")
+		{
+			benchmarkParticles(std::cout);
+			ran = true;
+		}
+
+		if (name == "all" || name == "headless")
+		{
+			benchmarkHeadlessWorld(std::cout);
+			ran = true;
+		}
+
+		if (name == "all" || name == "culling")
+		{
+			passed = benchmarkCulling(std::cout) && passed;
+			ran = true;
+		}
+
+		if (name == "all" || name == "commandalloc")
+		{
+			passed = benchmarkCommandAllocations(std::cout) && passed;
+			ran = true;
+		}
+
+		if (name == "all" || name == "broadphases")
+		{
+			passed = benchmarkBroadphaseScenarios(std::cout) && passed;
+			ran = true;
+		}
+
+		if (name == "all" || name == "scenarios")
+		{
+			std::ofstream csv;
+			if (!csvPath.empty())
+			{
+				csv.open(csvPath);
+				if (!csv)
+				{
+					std::cerr << "cannot write '" << csvPath << "'" << std::endl;
+					return 1;
+				}
+			}
+
+			benchmarkScenarios(std::cout, csv.is_open() ? &csv : nullptr);
+			ran = true;
+		}
+
+		if (!ran)
+		{
+			std::cerr << "unknown benchmark '" << name << "'" << std::endl;
+			return 1;
+		}
+
+		if (!passed)
+		{
+			std::cerr << "a check failed, see MISMATCH, ALLOCATES or NOT MEASURED above" << std::endl;
+			return 1;
+		}
+
+		return 0;
+	}
+}
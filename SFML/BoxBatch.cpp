@@ -0,0 +1,178 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* BoxBatch Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#include "BoxBatch.h"
+
+#include <algorithm>
+
+#if GEX_SIMD_BOXES
+#include <xmmintrin.h>
+#endif
+
+namespace GEX
+{
+	BoxBatch::BoxBatch()
+		: size_(0)
+		, minX_()
+		, minY_()
+		, maxX_()
+		, maxY_()
+	{}
+
+	void BoxBatch::clear()
+	{
+		size_ = 0;
+		minX_.clear();
+		minY_.clear();
+		maxX_.clear();
+		maxY_.clear();
+	}
+
+	void BoxBatch::reserve(std::size_t count)
+	{
+		std::size_t padded = (count + PACK_SIZE - 1) / PACK_SIZE * PACK_SIZE;
+
+		minX_.reserve(padded);
+		minY_.reserve(padded);
+		maxX_.reserve(padded);
+		maxY_.reserve(padded);
+	}
+
+	void BoxBatch::add(const sf::FloatRect& rect)
+	{
+		// starting a new pack, pad all of it; the padding is overwritten box by box
+		if (size_ % PACK_SIZE == 0)
+		{
+			minX_.resize(size_ + PACK_SIZE, 0.f);
+			minY_.resize(size_ + PACK_SIZE, 0.f);
+			maxX_.resize(size_ + PACK_SIZE, 0.f);
+			maxY_.resize(size_ + PACK_SIZE, 0.f);
+		}
+
+		// the same edges sf::FloatRect::intersects works with
+		float right = rect.left + rect.width;
+		float bottom = rect.top + rect.height;
+
+		minX_[size_] = std::min(rect.left, right);
+		minY_[size_] = std::min(rect.top, bottom);
+		maxX_[size_] = std::max(rect.left, right);
+		maxY_[size_] = std::max(rect.top, bottom);
+		++size_;
+	}
+
+	void BoxBatch::findOverlaps(const sf::FloatRect& rect, std::vector<std::size_t>& overlaps, std::size_t first) const
+	{
+#if GEX_SIMD_BOXES
+		float right = rect.left + rect.width;
+		float bottom = rect.top + rect.height;
+
+		float minX = std::min(rect.left, right);
+		float minY = std::min(rect.top, bottom);
+		float maxX = std::max(rect.left, right);
+		float maxY = std::max(rect.top, bottom);
+
+		// intersects() needs max(min) < min(max) on both axes, which is four compares
+		// per axis; the two that only involve rect are done once here
+		if (!(minX < maxX) || !(minY < maxY) || first >= size_)
+			return;
+
+		const __m128 queryMinX = _mm_set1_ps(minX);
+		const __m128 queryMinY = _mm_set1_ps(minY);
+		const __m128 queryMaxX = _mm_set1_ps(maxX);
+		const __m128 queryMaxY = _mm_set1_ps(maxY);
+
+		// the pack holding first is tested whole, the boxes before first are masked off
+		std::size_t pack = first / PACK_SIZE * PACK_SIZE;
+		int skipped = (1 << (first - pack)) - 1;
+
+		for (; pack < size_; pack += PACK_SIZE)
+		{
+			__m128 boxMinX = _mm_loadu_ps(&minX_[pack]);
+			__m128 boxMinY = _mm_loadu_ps(&minY_[pack]);
+			__m128 boxMaxX = _mm_loadu_ps(&maxX_[pack]);
+			__m128 boxMaxY = _mm_loadu_ps(&maxY_[pack]);
+
+			__m128 overlapX = _mm_and_ps(_mm_and_ps(_mm_cmplt_ps(boxMinX, queryMaxX), _mm_cmplt_ps(queryMinX, boxMaxX)), 
+										 _mm_cmplt_ps(boxMinX, boxMaxX));
+			__m128 overlapY = _mm_and_ps(_mm_and_ps(_mm_cmplt_ps(boxMinY, queryMaxY), _mm_cmplt_ps(queryMinY, boxMaxY)), 
+										 _mm_cmplt_ps(boxMinY, boxMaxY));
+
+			int mask = _mm_movemask_ps(_mm_and_ps(overlapX, overlapY)) & ~skipped;
+			skipped = 0;
+
+			for (std::size_t i = 0; mask != 0; ++i, mask >>= 1)
+			{
+				if (mask & 1)
+					overlaps.push_back(pack + i);
+			}
+		}
+#else
+		findOverlapsScalar(rect, overlaps, first);
+#endif
+	}
+
+	void BoxBatch::findOverlapsScalar(const sf::FloatRect& rect, std::vector<std::size_t>& overlaps, std::size_t first) const
+	{
+		float right = rect.left + rect.width;
+		float bottom = rect.top + rect.height;
+
+		float minX = std::min(rect.left, right);
+		float minY = std::min(rect.top, bottom);
+		float maxX = std::max(rect.left, right);
+		float maxY = std::max(rect.top, bottom);
+
+		for (std::size_t i = first; i < size_; ++i)
+		{
+			if (std::max(minX, minX_[i]) < std::min(maxX, maxX_[i]) && 
+				std::max(minY, minY_[i]) < std::min(maxY, maxY_[i]))
+				overlaps.push_back(i);
+		}
+	}
+
+	std::size_t BoxBatch::size() const
+	{
+		return size_;
+	}
+
+	bool BoxBatch::empty() const
+	{
+		return size_ == 0;
+	}
+
+	bool BoxBatch::isAccelerated()
+	{
+		return GEX_SIMD_BOXES != 0;
+	}
+}
\ No newline at end of file
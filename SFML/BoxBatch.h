@@ -0,0 +1,91 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* BoxBatch Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#pragma once
+
+#include <SFML\Graphics\Rect.hpp>
+
+#include <cstddef>
+#include <vector>
+
+// SSE is part of every x64 target and the MSVC x86 default; define GEX_NO_SIMD to
+// build the scalar kernel only
+#if !defined(GEX_NO_SIMD) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1) || defined(__SSE__))
+#define GEX_SIMD_BOXES 1
+#else
+#define GEX_SIMD_BOXES 0
+#endif
+
+namespace GEX
+{
+	// Axis aligned boxes kept as separate minX/minY/maxX/maxY arrays, so one box is
+	// tested against four of them with a handful of SSE compares. For rects without
+	// NaNs the answer is exactly what sf::FloatRect::intersects gives: touching edges
+	// don't overlap and neither does a rect without area.
+	class BoxBatch
+	{
+	public:
+		static const std::size_t	PACK_SIZE = 4;
+
+	public:
+								BoxBatch();
+
+		void					clear();
+		void					reserve(std::size_t count);
+
+			// negative widths and heights are fine, like in sf::FloatRect
+		void					add(const sf::FloatRect& rect);
+
+			// appends the index of every box from first on that overlaps rect
+		void					findOverlaps(const sf::FloatRect& rect, std::vector<std::size_t>& overlaps, std::size_t first = 0) const;
+
+			// the fallback; the same answers, one box at a time
+		void					findOverlapsScalar(const sf::FloatRect& rect, std::vector<std::size_t>& overlaps, std::size_t first = 0) const;
+
+		std::size_t				size() const;
+		bool					empty() const;
+
+		static bool				isAccelerated();
+
+	private:
+		std::size_t				size_;
+
+			// padded to whole packs with boxes that have no area and never overlap
+		std::vector<float>		minX_;
+		std::vector<float>		minY_;
+		std::vector<float>		maxX_;
+		std::vector<float>		maxY_;
+	};
+}
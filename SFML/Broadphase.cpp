@@ -0,0 +1,75 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Broadphase Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#include "Broadphase.h"
+#include "BruteForceBroadphase.h"
+#include "SpatialHash.h"
+#include "SweepAndPrune.h"
+
+#include <cassert>
+
+namespace GEX
+{
+	std::unique_ptr<Broadphase> Broadphase::create(Type type)
+	{
+		switch (type)
+		{
+		case Type::BruteForce:
+			return std::unique_ptr<Broadphase>(new BruteForceBroadphase());
+		case Type::SpatialHash:
+			return std::unique_ptr<Broadphase>(new SpatialHash());
+		case Type::SweepAndPrune:
+			return std::unique_ptr<Broadphase>(new SweepAndPrune());
+		default:
+			assert(false);
+			return nullptr;
+		}
+	}
+
+	const char* Broadphase::getName(Type type)
+	{
+		switch (type)
+		{
+		case Type::BruteForce:
+			return "brute force";
+		case Type::SpatialHash:
+			return "spatial hash";
+		case Type::SweepAndPrune:
+			return "sweep and prune";
+		default:
+			return "unknown";
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Broadphase Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#pragma once
+
+#include <SFML\Graphics\Rect.hpp>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace GEX
+{
+	class SceneNode;
+	class CollisionMatrix;
+	class CollisionPairs;
+
+	// Finds the pairs of nodes whose bounding boxes overlap without testing every
+	// node against every other. World rebuilds it once a tick from the collidable
+	// nodes, resolves the pairs it finds and lets bullets query it.
+	class Broadphase
+	{
+	public:
+		enum class Type
+		{
+			BruteForce,
+			SpatialHash,
+			SweepAndPrune,
+			TypeCount
+		};
+
+			// return true to stop the query
+		using Visitor = std::function<bool(SceneNode& node, const sf::FloatRect& bounds)>;
+
+	public:
+		virtual					~Broadphase() = default;
+
+		static std::unique_ptr<Broadphase>	create(Type type);
+		static const char*		getName(Type type);
+
+			// the nodes taking part this tick; none of them may be destroyed yet
+		virtual void			update(const std::vector<SceneNode*>& nodes) = 0;
+
+			// pairs the matrix turns away are never bounds tested; builds collisionPairs
+			// once they are all in
+		virtual void			findPairs(const CollisionMatrix& matrix, CollisionPairs& collisionPairs) const = 0;
+
+			// calls visitor(node, bounds) for nodes that may overlap area until it returns
+			// true; a node can be visited more than once
+		virtual bool			query(const sf::FloatRect& area, const Visitor& visitor) const = 0;
+
+		virtual std::size_t		getNodeCount() const = 0;
+	};
+}
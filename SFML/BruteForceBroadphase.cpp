@@ -0,0 +1,97 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* BruteForceBroadphase Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#include "BruteForceBroadphase.h"
+#include "CollisionMatrix.h"
+#include "CollisionPairs.h"
+#include "SceneNode.h"
+
+namespace GEX
+{
+	BruteForceBroadphase::BruteForceBroadphase()
+		: entries_()
+		, boxes_()
+		, overlaps_()
+	{}
+
+	void BruteForceBroadphase::update(const std::vector<SceneNode*>& nodes)
+	{
+		entries_.clear();
+		boxes_.clear();
+		for (SceneNode* node : nodes)
+		{
+			entries_.push_back({ node, node->getBoundingBox(), node->getCategory() });
+			boxes_.add(entries_.back().bounds);
+		}
+	}
+
+	void BruteForceBroadphase::findPairs(const CollisionMatrix& matrix, CollisionPairs& collisionPairs) const
+	{
+		for (std::size_t i = 0; i < entries_.size(); ++i)
+		{
+			const Entry& lhs = entries_[i];
+
+			for (std::size_t j = i + 1; j < entries_.size(); ++j)
+			{
+				const Entry& rhs = entries_[j];
+
+				if (matrix.accepts(lhs.category, lhs.bounds, rhs.category, rhs.bounds))
+					collisionPairs.insert(*lhs.node, *rhs.node);
+			}
+		}
+
+		collisionPairs.build();
+	}
+
+	bool BruteForceBroadphase::query(const sf::FloatRect& area, const Visitor& visitor) const
+	{
+		// still every node, but four at a time and only the overlapping ones reach visitor
+		overlaps_.clear();
+		boxes_.findOverlaps(area, overlaps_);
+
+		for (std::size_t index : overlaps_)
+		{
+			if (visitor(*entries_[index].node, entries_[index].bounds))
+				return true;
+		}
+
+		return false;
+	}
+
+	std::size_t BruteForceBroadphase::getNodeCount() const
+	{
+		return entries_.size();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* BruteForceBroadphase Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#pragma once
+
+#include "Broadphase.h"
+#include "BoxBatch.h"
+
+#include <vector>
+
+namespace GEX
+{
+	// Every node against every other node. The reference the other broadphases are
+	// measured and checked against.
+	class BruteForceBroadphase : public Broadphase
+	{
+	public:
+								BruteForceBroadphase();
+
+		void					update(const std::vector<SceneNode*>& nodes) override;
+		void					findPairs(const CollisionMatrix& matrix, CollisionPairs& collisionPairs) const override;
+		bool					query(const sf::FloatRect& area, const Visitor& visitor) const override;
+		std::size_t				getNodeCount() const override;
+
+	private:
+		struct Entry
+		{
+			SceneNode*			node;
+			sf::FloatRect		bounds;
+			unsigned int		category;
+		};
+
+	private:
+		std::vector<Entry>		entries_;
+		BoxBatch				boxes_;			// the bounds of entries_, for queries
+		mutable std::vector<std::size_t>	overlaps_;
+	};
+}
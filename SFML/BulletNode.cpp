@@ -0,0 +1,275 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* BulletNode Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "BulletNode.h"
+#include "DataTables.h"
+#include "Broadphase.h"
+#include "Category.h"
+#include "SpriteBatch.h"
+
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <cassert>
+
+namespace GEX
+{
+	BulletNode::BulletNode(const TextureManager& textures)
+		: SceneNode()
+		, bulletTypes_()
+		, texture_(textures.find(TextureID::Entities))
+		, positionsX_()
+		, positionsY_()
+		, velocitiesX_()
+		, velocitiesY_()
+		, lifetimes_()
+		, types_()
+		, vertexArray_(sf::Quads)
+		, needsVertexUpdate_(true)
+	{
+		const ProjectileTable table = initializeProjectileData();
+
+		for (std::size_t i = 0; i < ProjectileTable::SIZE; ++i)
+		{
+			Projectile::Type projectileType = static_cast<Projectile::Type>(i);
+			const ProjectileData& data = table[projectileType];
+			BulletType type;
+
+			type.damage = data.damage;
+			type.speed = data.speed;
+			type.lifetime = data.lifetime.asSeconds();
+			type.targets = projectileType == Projectile::Type::EnemyBullet ? Category::PlayerAircraft : Category::EnemyAircraft;
+			type.halfSize = sf::Vector2f(data.textureRect.width / 2.f, data.textureRect.height / 2.f);
+			type.textureRect = sf::FloatRect(data.textureRect);
+
+			bulletTypes_.push_back(type);
+		}
+
+		positionsX_.reserve(INITIAL_CAPACITY);
+		positionsY_.reserve(INITIAL_CAPACITY);
+		velocitiesX_.reserve(INITIAL_CAPACITY);
+		velocitiesY_.reserve(INITIAL_CAPACITY);
+		lifetimes_.reserve(INITIAL_CAPACITY);
+		types_.reserve(INITIAL_CAPACITY);
+	}
+
+	void BulletNode::addBullet(Projectile::Type type, sf::Vector2f position, sf::Vector2f velocity)
+	{
+		// missiles steer, they stay Projectile nodes
+		assert(type != Projectile::Type::Missile);
+
+		positionsX_.push_back(position.x);
+		positionsY_.push_back(position.y);
+		velocitiesX_.push_back(velocity.x);
+		velocitiesY_.push_back(velocity.y);
+		lifetimes_.push_back(bulletTypes_[static_cast<std::size_t>(type)].lifetime);
+		types_.push_back(static_cast<std::uint8_t>(type));
+	}
+
+	void BulletNode::removeOutside(const sf::FloatRect& area)
+	{
+		const std::size_t count = lifetimes_.size();
+		const float* x = positionsX_.data();
+		const float* y = positionsY_.data();
+		float* lifetime = lifetimes_.data();
+
+		const float right = area.left + area.width;
+		const float bottom = area.top + area.height;
+
+		// only flag them here, removeExpired() compacts the arrays once per tick
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			bool inside = x[i] >= area.left && x[i] < right && y[i] >= area.top && y[i] < bottom;
+			lifetime[i] = inside ? lifetime[i] : 0.f;
+		}
+	}
+
+	void BulletNode::checkCollisions(const Broadphase& broadphase, const HitHandler& onHit)
+	{
+		if (broadphase.getNodeCount() == 0)
+			return;
+
+		// built once and pointed at each bullet in turn, not one std::function per bullet
+		const BulletType* type = nullptr;
+		sf::FloatRect bounds;
+		Broadphase::Visitor strike = [&](SceneNode& node, const sf::FloatRect& nodeBounds)
+		{
+			if (!(node.getCategory() & type->targets) || !bounds.intersects(nodeBounds))
+				return false;
+
+			onHit(node, type->damage);
+			return true;
+		};
+
+		for (std::size_t i = 0; i < lifetimes_.size(); ++i)
+		{
+			if (lifetimes_[i] <= 0.f)
+				continue;
+
+			type = &bulletTypes_[types_[i]];
+			bounds = sf::FloatRect(positionsX_[i] - type->halfSize.x, positionsY_[i] - type->halfSize.y, 
+								   2.f * type->halfSize.x, 2.f * type->halfSize.y);
+
+			bool struck = broadphase.query(bounds, strike);
+
+			if (struck)
+				lifetimes_[i] = 0.f;
+		}
+	}
+
+	float BulletNode::getMaxSpeed(Projectile::Type type) const
+	{
+		return bulletTypes_[static_cast<std::size_t>(type)].speed;
+	}
+
+	std::size_t BulletNode::getBulletCount() const
+	{
+		return lifetimes_.size();
+	}
+
+	unsigned int BulletNode::getCategory() const
+	{
+		return Category::BulletSystem;
+	}
+
+	sf::FloatRect BulletNode::getDrawBounds() const
+	{
+		// bullets are spread over the whole world, not worth a bounds pass of their own
+		return UNBOUNDED;
+	}
+
+	void BulletNode::updateCurrent(sf::Time dt, CommandQueue & commands)
+	{
+		// Drop bullets that hit something, left the battlefield or aged out last tick
+		removeExpired();
+
+		const std::size_t count = lifetimes_.size();
+		const float seconds = dt.asSeconds();
+
+		float* x = positionsX_.data();
+		float* y = positionsY_.data();
+		const float* vx = velocitiesX_.data();
+		const float* vy = velocitiesY_.data();
+		float* lifetime = lifetimes_.data();
+
+		// Straight line integration, no branches so the compiler can vectorize it
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			x[i] += vx[i] * seconds;
+			y[i] += vy[i] * seconds;
+			lifetime[i] -= seconds;
+		}
+
+		// Mark for update
+		needsVertexUpdate_ = true;
+	}
+
+	void BulletNode::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	{
+		if (needsVertexUpdate_)
+		{
+			computeVertices();
+			needsVertexUpdate_ = false;
+		}
+
+		states.texture = texture_;
+
+		// One draw call for every bullet in the world
+		target.draw(vertexArray_, states);
+	}
+
+	void BulletNode::batchCurrent(SpriteBatch & batch, sf::RenderStates states) const
+	{
+		// already a single vertex array, drawn in its turn
+		batch.defer(*this, states);
+	}
+
+	void BulletNode::removeExpired()
+	{
+		std::size_t i = 0;
+
+		// swap the last bullet into the hole, bullet order does not matter
+		while (i < lifetimes_.size())
+		{
+			if (lifetimes_[i] > 0.f)
+			{
+				++i;
+				continue;
+			}
+
+			positionsX_[i] = positionsX_.back();
+			positionsY_[i] = positionsY_.back();
+			velocitiesX_[i] = velocitiesX_.back();
+			velocitiesY_[i] = velocitiesY_.back();
+			lifetimes_[i] = lifetimes_.back();
+			types_[i] = types_.back();
+
+			positionsX_.pop_back();
+			positionsY_.pop_back();
+			velocitiesX_.pop_back();
+			velocitiesY_.pop_back();
+			lifetimes_.pop_back();
+			types_.pop_back();
+		}
+	}
+
+	void BulletNode::computeVertices() const
+	{
+		const std::size_t count = lifetimes_.size();
+
+		// Refill vertex array, four corners per bullet
+		vertexArray_.resize(count * 4);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const BulletType& type = bulletTypes_[types_[i]];
+			const sf::FloatRect& rect = type.textureRect;
+
+			float left = positionsX_[i] - type.halfSize.x;
+			float right = positionsX_[i] + type.halfSize.x;
+			float top = positionsY_[i] - type.halfSize.y;
+			float bottom = positionsY_[i] + type.halfSize.y;
+
+			sf::Vertex* quad = &vertexArray_[i * 4];
+
+			quad[0].position = sf::Vector2f(left, top);
+			quad[1].position = sf::Vector2f(right, top);
+			quad[2].position = sf::Vector2f(right, bottom);
+			quad[3].position = sf::Vector2f(left, bottom);
+
+			quad[0].texCoords = sf::Vector2f(rect.left, rect.top);
+			quad[1].texCoords = sf::Vector2f(rect.left + rect.width, rect.top);
+			quad[2].texCoords = sf::Vector2f(rect.left + rect.width, rect.top + rect.height);
+			quad[3].texCoords = sf::Vector2f(rect.left, rect.top + rect.height);
+		}
+	}
+}
@@ -0,0 +1,111 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* BulletNode Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include "SceneNode.h"
+#include "Projectile.h"
+#include "TextureManager.h"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace GEX
+{
+	class Broadphase;
+
+	// Every bullet in the world, kept as parallel arrays instead of one Projectile
+	// node each. Bullets fly in a straight line, so a tick is a single pass over the
+	// arrays and drawing is one vertex array from the Entities atlas.
+	class BulletNode : public SceneNode
+	{
+	public:
+			// room reserved up front, so a heavy fight doesn't grow the arrays mid game
+		static const std::size_t	INITIAL_CAPACITY = 1024;
+
+		using HitHandler = std::function<void(SceneNode& target, int damage)>;
+
+	public:
+		explicit			BulletNode(const TextureManager& textures);
+
+		void				addBullet(Projectile::Type type, sf::Vector2f position, sf::Vector2f velocity);
+		void				removeOutside(const sf::FloatRect& area);
+
+			// tests every bullet against the nodes in broadphase; a bullet that strikes
+			// one of its targets is reported to onHit and removed
+		void				checkCollisions(const Broadphase& broadphase, const HitHandler& onHit);
+
+		float				getMaxSpeed(Projectile::Type type) const;
+		std::size_t			getBulletCount() const;
+		unsigned int		getCategory() const override;
+		sf::FloatRect		getDrawBounds() const override;
+
+	private:
+		void				updateCurrent(sf::Time dt, CommandQueue& commands) override;
+		void				drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		void				batchCurrent(SpriteBatch& batch, sf::RenderStates states) const override;
+
+		void				removeExpired();
+		void				computeVertices() const;
+
+	private:
+		// table values the hot loops need, looked up once per type
+		struct BulletType
+		{
+			int				damage;
+			float			speed;
+			float			lifetime;
+			unsigned int	targets;
+			sf::Vector2f	halfSize;
+			sf::FloatRect	textureRect;
+		};
+
+	private:
+		std::vector<BulletType>		bulletTypes_;
+		const sf::Texture*			texture_;
+
+		std::vector<float>			positionsX_;
+		std::vector<float>			positionsY_;
+		std::vector<float>			velocitiesX_;
+		std::vector<float>			velocitiesY_;
+		std::vector<float>			lifetimes_;
+		std::vector<std::uint8_t>	types_;
+
+		mutable sf::VertexArray		vertexArray_;
+		mutable bool				needsVertexUpdate_;
+	};
+}
@@ -47,6 +47,7 @@ namespace Category
 		SceneAirLayer		= 1 << 6,
 		Pickup				= 1 << 7,
 		ParticleSystem		= 1 << 8,
+		BulletSystem		= 1 << 9,
 
 		Aircraft	 = PlayerAircraft | AlliedAircraft | EnemyAircraft,
 		Projectile	 = EnemyProjectile | AlliedProjectile
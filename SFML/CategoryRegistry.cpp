@@ -0,0 +1,133 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* CategoryRegistry Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#include "CategoryRegistry.h"
+#include "SceneNode.h"
+#include "Command.h"
+
+#include <cassert>
+
+namespace GEX
+{
+	CategoryRegistry::CategoryRegistry()
+		: buckets_()
+	{
+		// nodes register under a single category bit, so this many buckets never move
+		buckets_.reserve(sizeof(unsigned int) * 8);
+	}
+
+	void CategoryRegistry::add(SceneNode& node)
+	{
+		assert(node.registeredCategory_ != Category::None);
+
+		std::size_t bucket = findBucket(node.registeredCategory_);
+
+		node.registryBucket_ = bucket;
+		node.registrySlot_ = buckets_[bucket].nodes.size();
+		buckets_[bucket].nodes.push_back(&node);
+	}
+
+	void CategoryRegistry::remove(SceneNode& node)
+	{
+		std::vector<SceneNode*>& nodes = buckets_[node.registryBucket_].nodes;
+		assert(nodes[node.registrySlot_] == &node);
+
+		// swap with the last node of the bucket so removal stays O(1)
+		SceneNode* last = nodes.back();
+		nodes[node.registrySlot_] = last;
+		last->registrySlot_ = node.registrySlot_;
+		nodes.pop_back();
+	}
+
+	void CategoryRegistry::reserve(unsigned int category)
+	{
+		findBucket(category);
+	}
+
+	std::size_t CategoryRegistry::findBucket(unsigned int category)
+	{
+		std::size_t bucket = 0;
+		while (bucket < buckets_.size() && buckets_[bucket].category != category)
+			++bucket;
+
+		if (bucket == buckets_.size())
+		{
+			buckets_.push_back({ category, {} });
+			buckets_.back().nodes.reserve(BUCKET_CAPACITY);
+		}
+
+		return bucket;
+	}
+
+	void CategoryRegistry::onCommand(const Command& command, sf::Time dt)
+	{
+		// commands may attach nodes (e.g. fire commands spawning projectiles), so
+		// iterate by index and leave nodes added during this pass alone
+		const std::size_t bucketCount = buckets_.size();
+
+		for (std::size_t b = 0; b < bucketCount; ++b)
+		{
+			if (!(buckets_[b].category & command.category))
+				continue;
+
+			const std::size_t nodeCount = buckets_[b].nodes.size();
+
+			for (std::size_t n = 0; n < nodeCount; ++n)
+				command.action(*buckets_[b].nodes[n], dt);
+		}
+	}
+
+	void CategoryRegistry::collectNodes(unsigned int category, std::vector<SceneNode*>& nodes) const
+	{
+		for (const Bucket& bucket : buckets_)
+		{
+			if (bucket.category & category)
+				nodes.insert(nodes.end(), bucket.nodes.begin(), bucket.nodes.end());
+		}
+	}
+
+	std::size_t CategoryRegistry::getNodeCount(unsigned int category) const
+	{
+		std::size_t count = 0;
+
+		for (const Bucket& bucket : buckets_)
+		{
+			if (bucket.category & category)
+				count += bucket.nodes.size();
+		}
+
+		return count;
+	}
+}
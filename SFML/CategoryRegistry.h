@@ -0,0 +1,85 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* CategoryRegistry Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#pragma once
+
+#include <SFML\System\Time.hpp>
+
+#include <vector>
+
+namespace GEX
+{
+	// forward declarations
+	class SceneNode;
+	struct Command;
+
+	// Keeps the nodes of a scene graph bucketed by category so a command only
+	// visits the nodes it is addressed to instead of the whole tree.
+	// SceneNode keeps it up to date on attach, detach and wreck removal.
+	class CategoryRegistry
+	{
+	public:
+			// room every new bucket starts with, so spawning doesn't grow it mid game
+		static const std::size_t	BUCKET_CAPACITY = 64;
+
+									CategoryRegistry();
+									CategoryRegistry(const CategoryRegistry&) = delete;
+									CategoryRegistry& operator=(const CategoryRegistry&) = delete;
+
+		void						add(SceneNode& node);
+		void						remove(SceneNode& node);
+
+			// creates the category's bucket now rather than when its first node is added
+		void						reserve(unsigned int category);
+
+		void						onCommand(const Command& command, sf::Time dt);
+
+		void						collectNodes(unsigned int category, std::vector<SceneNode*>& nodes) const;
+		std::size_t					getNodeCount(unsigned int category) const;
+
+	private:
+		struct Bucket
+		{
+			unsigned int			category;
+			std::vector<SceneNode*>	nodes;
+		};
+
+	private:
+		std::size_t					findBucket(unsigned int category);
+
+	private:
+		std::vector<Bucket>			buckets_;
+	};
+}
@@ -0,0 +1,170 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* CollisionMatrix Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#include "CollisionMatrix.h"
+#include "SceneNode.h"
+
+#include <cassert>
+
+namespace GEX
+{
+	namespace
+	{
+		// index of the lowest set bit, a de Bruijn multiply instead of a loop over the bits
+		std::size_t bitIndex(unsigned int category)
+		{
+			static const std::uint8_t POSITIONS[32] =
+			{
+				0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+				31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+			};
+
+			assert(category != 0);
+			std::uint32_t lowest = category & (0u - category);
+			return POSITIONS[static_cast<std::uint32_t>(lowest * 0x077CB531u) >> 27];
+		}
+	}
+
+	const std::size_t CollisionMatrix::CATEGORY_BITS;
+	const std::uint8_t CollisionMatrix::NO_RULE;
+	thread_local CollisionMatrix::Statistics CollisionMatrix::statistics_ = { 0, 0 };
+
+	CollisionMatrix::CollisionMatrix()
+		: partners_()
+		, ruleIndices_()
+		, rules_()
+	{
+		ruleIndices_.fill(NO_RULE);
+	}
+
+	void CollisionMatrix::allow(unsigned int first, unsigned int second, Handler handler)
+	{
+		assert(first < (1u << CATEGORY_BITS) && second < (1u << CATEGORY_BITS));
+		assert(rules_.size() < NO_RULE);
+
+		std::uint8_t index = static_cast<std::uint8_t>(rules_.size());
+		rules_.push_back({ first, std::move(handler) });
+
+		for (std::size_t i = 0; i < CATEGORY_BITS; ++i)
+		{
+			for (std::size_t j = 0; j < CATEGORY_BITS; ++j)
+			{
+				if ((first & (1u << i)) && (second & (1u << j)))
+				{
+					partners_[i] |= 1u << j;
+					partners_[j] |= 1u << i;
+					ruleIndices_[i * CATEGORY_BITS + j] = index;
+					ruleIndices_[j * CATEGORY_BITS + i] = index;
+				}
+			}
+		}
+	}
+
+	bool CollisionMatrix::accepts(unsigned int lhsCategory, unsigned int rhsCategory) const
+	{
+		// nodes usually carry a single bit, so this loop runs once
+		unsigned int partners = 0;
+		for (unsigned int bits = lhsCategory; bits != 0; bits &= bits - 1)
+		{
+			assert(bitIndex(bits) < CATEGORY_BITS);
+			partners |= partners_[bitIndex(bits)];
+		}
+
+		if (partners & rhsCategory)
+		{
+			++statistics_.tested;
+			return true;
+		}
+
+		++statistics_.rejected;
+		return false;
+	}
+
+	bool CollisionMatrix::accepts(unsigned int lhsCategory, const sf::FloatRect& lhsBounds, 
+								  unsigned int rhsCategory, const sf::FloatRect& rhsBounds) const
+	{
+		return accepts(lhsCategory, rhsCategory) && lhsBounds.intersects(rhsBounds);
+	}
+
+	bool CollisionMatrix::dispatch(SceneNode& lhs, SceneNode& rhs) const
+	{
+		unsigned int lhsCategory = lhs.getCategory();
+		unsigned int rhsCategory = rhs.getCategory();
+
+		if (lhsCategory == 0 || rhsCategory == 0)
+			return false;
+
+		// handlers may use the hitpoints of a node, and a wreck has none left
+		if (lhs.isDestroyed() || rhs.isDestroyed())
+			return false;
+
+		std::uint8_t index = ruleIndices_[bitIndex(lhsCategory) * CATEGORY_BITS + bitIndex(rhsCategory)];
+		if (index == NO_RULE)
+			return false;
+
+		const Rule& rule = rules_[index];
+		if (!rule.handler)
+			return false;
+
+		if (rule.first & lhsCategory)
+			rule.handler(lhs, rhs);
+		else
+			rule.handler(rhs, lhs);
+
+		return true;
+	}
+
+	unsigned int CollisionMatrix::getCategories() const
+	{
+		unsigned int categories = 0;
+		for (std::size_t i = 0; i < CATEGORY_BITS; ++i)
+		{
+			if (partners_[i])
+				categories |= 1u << i;
+		}
+
+		return categories;
+	}
+
+	CollisionMatrix::Statistics CollisionMatrix::getStatistics()
+	{
+		return statistics_;
+	}
+
+	void CollisionMatrix::resetStatistics()
+	{
+		statistics_ = { 0, 0 };
+	}
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* CollisionMatrix Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#pragma once
+
+#include <SFML\Graphics\Rect.hpp>
+
+#include "Category.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace GEX
+{
+	class SceneNode;
+
+	// Which categories can hit which, and what happens when they do. A pair of nodes
+	// is only handed to the geometry test if a handler is registered for their
+	// categories, so enemy vs enemy or bullet vs bullet never costs a bounding box.
+	class CollisionMatrix
+	{
+	public:
+			// called with the nodes in the order the rule was declared in
+		using Handler = std::function<void(SceneNode&, SceneNode&)>;
+
+			// category pairs that went on to the geometry test and pairs the matrix turned away
+		struct Statistics
+		{
+			std::size_t			tested;
+			std::size_t			rejected;
+		};
+
+			// enough for every bit of Category::Type
+		static const std::size_t	CATEGORY_BITS = 16;
+
+	public:
+								CollisionMatrix();
+
+			// every category bit of first against every bit of second; a later rule for
+			// the same pair replaces the earlier one
+		void					allow(unsigned int first, unsigned int second, Handler handler = Handler());
+
+			// counts the pair in the statistics as tested or rejected
+		bool					accepts(unsigned int lhsCategory, unsigned int rhsCategory) const;
+		bool					accepts(unsigned int lhsCategory, const sf::FloatRect& lhsBounds, 
+										unsigned int rhsCategory, const sf::FloatRect& rhsBounds) const;
+
+			// runs the handler of the pair's rule, false if there is none or an earlier
+			// pair of the same tick already destroyed one of the nodes
+		bool					dispatch(SceneNode& lhs, SceneNode& rhs) const;
+
+			// union of the categories that appear in any rule
+		unsigned int			getCategories() const;
+
+		static Statistics		getStatistics();
+		static void				resetStatistics();
+
+	private:
+		struct Rule
+		{
+			unsigned int		first;
+			Handler				handler;
+		};
+
+		static const std::uint8_t	NO_RULE = 0xff;
+
+	private:
+		std::array<unsigned int, CATEGORY_BITS>					partners_;		// categories bit i collides with
+		std::array<std::uint8_t, CATEGORY_BITS * CATEGORY_BITS>	ruleIndices_;	// rules_ index of the pair of bits, NO_RULE if none
+		std::vector<Rule>										rules_;
+
+		static thread_local Statistics	statistics_;
+	};
+}
@@ -0,0 +1,101 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* CollisionPairs Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#include "CollisionPairs.h"
+
+#include <algorithm>
+
+namespace GEX
+{
+	namespace
+	{
+		bool lessById(const SceneNode::Pair& lhs, const SceneNode::Pair& rhs)
+		{
+			if (lhs.first->getId() != rhs.first->getId())
+				return lhs.first->getId() < rhs.first->getId();
+
+			return lhs.second->getId() < rhs.second->getId();
+		}
+	}
+
+	CollisionPairs::CollisionPairs()
+		: pairs_()
+	{}
+
+	void CollisionPairs::clear()
+	{
+		pairs_.clear();
+	}
+
+	void CollisionPairs::insert(SceneNode& lhs, SceneNode& rhs)
+	{
+		if (lhs.getId() < rhs.getId())
+			pairs_.emplace_back(&lhs, &rhs);
+		else
+			pairs_.emplace_back(&rhs, &lhs);
+	}
+
+	void CollisionPairs::build()
+	{
+		// ids are unique, so equal ids mean the same nodes
+		std::sort(pairs_.begin(), pairs_.end(), lessById);
+		pairs_.erase(std::unique(pairs_.begin(), pairs_.end()), pairs_.end());
+	}
+
+	CollisionPairs::const_iterator CollisionPairs::begin() const
+	{
+		return pairs_.begin();
+	}
+
+	CollisionPairs::const_iterator CollisionPairs::end() const
+	{
+		return pairs_.end();
+	}
+
+	std::size_t CollisionPairs::size() const
+	{
+		return pairs_.size();
+	}
+
+	bool CollisionPairs::empty() const
+	{
+		return pairs_.empty();
+	}
+
+	bool CollisionPairs::operator==(const CollisionPairs& other) const
+	{
+		return pairs_ == other.pairs_;
+	}
+}
\ No newline at end of file
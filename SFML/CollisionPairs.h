@@ -0,0 +1,76 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* CollisionPairs Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#pragma once
+
+#include "SceneNode.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace GEX
+{
+	// The colliding pairs of a tick. Pairs are appended to a flat vector that keeps
+	// its memory from tick to tick, then sorted by node id and deduplicated once, so
+	// they are resolved in the same order on every run instead of in address order.
+	class CollisionPairs
+	{
+	public:
+		using const_iterator = std::vector<SceneNode::Pair>::const_iterator;
+
+	public:
+								CollisionPairs();
+
+			// drops the pairs but keeps the capacity
+		void					clear();
+
+			// the same pair may be inserted more than once, build() folds the copies
+		void					insert(SceneNode& lhs, SceneNode& rhs);
+
+			// sorts and deduplicates; call once after the inserts, before iterating
+		void					build();
+
+		const_iterator			begin() const;
+		const_iterator			end() const;
+
+		std::size_t				size() const;
+		bool					empty() const;
+
+		bool					operator==(const CollisionPairs& other) const;
+
+	private:
+		std::vector<SceneNode::Pair>	pairs_;		// first has the lower id
+	};
+}
@@ -38,9 +38,93 @@
 
 namespace GEX
 { 
+	CommandAction::CommandAction()
+		: invoker_(nullptr)
+		, manager_(nullptr)
+	{
+	}
+
+	CommandAction::CommandAction(CommandAction && other)
+		: invoker_(other.invoker_)
+		, manager_(other.manager_)
+	{
+		if (manager_)
+			manager_(Operation::Move, &storage_, &other.storage_);
+
+		other.invoker_ = nullptr;
+		other.manager_ = nullptr;
+	}
+
+	CommandAction::~CommandAction()
+	{
+		reset();
+	}
+
+	CommandAction & CommandAction::operator=(CommandAction && other)
+	{
+		if (this != &other)
+		{
+			reset();
+
+			invoker_ = other.invoker_;
+			manager_ = other.manager_;
+
+			if (manager_)
+				manager_(Operation::Move, &storage_, &other.storage_);
+
+			other.invoker_ = nullptr;
+			other.manager_ = nullptr;
+		}
+
+		return *this;
+	}
+
+	void CommandAction::operator()(SceneNode & node, sf::Time dt) const
+	{
+		assert(invoker_);
+		invoker_(&storage_, node, dt);
+	}
+
+	CommandAction::operator bool() const
+	{
+		return invoker_ != nullptr;
+	}
+
+	CommandAction CommandAction::clone() const
+	{
+		CommandAction copy;
+
+		if (manager_)
+		{
+			manager_(Operation::Copy, &copy.storage_, &storage_);
+			copy.invoker_ = invoker_;
+			copy.manager_ = manager_;
+		}
+
+		return copy;
+	}
+
+	void CommandAction::reset()
+	{
+		if (manager_)
+			manager_(Operation::Destroy, &storage_, nullptr);
+
+		invoker_ = nullptr;
+		manager_ = nullptr;
+	}
+
 	Command::Command()
 		: action()
 		, category(Category::Type::None)
 	{
 	}
+
+	Command Command::clone() const
+	{
+		Command copy;
+		copy.action = action.clone();
+		copy.category = category;
+
+		return copy;
+	}
 }
\ No newline at end of file
@@ -36,8 +36,11 @@
 
 #include <SFML\System\Time.hpp>
 
-#include <functional>
 #include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace GEX
 { 
@@ -45,17 +48,111 @@ namespace GEX
 	//forward declaration
 	class SceneNode;
 
+	// Type-erased callable stored in a fixed inline buffer, so creating, moving and
+	// invoking a command never allocates. Callables larger than CAPACITY are rejected
+	// at compile time instead of silently falling back to the heap.
+	class CommandAction
+	{
+	public:
+		static const std::size_t	CAPACITY = 48;
+
+	public:
+									CommandAction();
+									CommandAction(CommandAction&& other);
+									CommandAction(const CommandAction&) = delete;
+									~CommandAction();
+
+		template <typename Function, typename = typename std::enable_if<
+			!std::is_same<typename std::decay<Function>::type, CommandAction>::value>::type>
+									CommandAction(Function fn);
+
+		CommandAction&				operator=(CommandAction&& other);
+		CommandAction&				operator=(const CommandAction&) = delete;
+
+		void						operator()(SceneNode& node, sf::Time dt) const;
+		explicit					operator bool() const;
+
+			// explicit copy for commands that are kept as templates and issued repeatedly
+		CommandAction				clone() const;
+
+	private:
+		enum class Operation
+		{
+			Move,
+			Copy,
+			Destroy
+		};
+
+		using Invoker = void(*)(const void* callable, SceneNode& node, sf::Time dt);
+		using Manager = void(*)(Operation operation, void* destination, const void* source);
+
+		template <typename Function>
+		static void					invoke(const void* callable, SceneNode& node, sf::Time dt);
+
+		template <typename Function>
+		static void					manage(Operation operation, void* destination, const void* source);
+
+		void						reset();
+
+	private:
+		std::aligned_storage<CAPACITY>::type	storage_;
+		Invoker									invoker_;
+		Manager									manager_;
+	};
+
 	struct Command
 	{
 	public:
 		Command();
+		Command(Command&& other) = default;
+		Command(const Command&) = delete;
+
+		Command&					operator=(Command&& other) = default;
+		Command&					operator=(const Command&) = delete;
+
+		Command						clone() const;
 		
-		std::function<void(SceneNode&, sf::Time)>	action;
-		unsigned int								category;
+		CommandAction				action;
+		unsigned int				category;
 	};
 
+	template <typename Function, typename>
+	CommandAction::CommandAction(Function fn)
+		: invoker_(&invoke<Function>)
+		, manager_(&manage<Function>)
+	{
+		static_assert(sizeof(Function) <= CAPACITY, "Command action captures too much state, raise CommandAction::CAPACITY");
+		static_assert(alignof(Function) <= alignof(std::aligned_storage<CAPACITY>::type), "Command action is over-aligned");
+
+		new (&storage_) Function(std::move(fn));
+	}
+
+	template <typename Function>
+	void CommandAction::invoke(const void* callable, SceneNode& node, sf::Time dt)
+	{
+		(*static_cast<const Function*>(callable))(node, dt);
+	}
+
+	template <typename Function>
+	void CommandAction::manage(Operation operation, void* destination, const void* source)
+	{
+		switch (operation)
+		{
+		case Operation::Move:
+			new (destination) Function(std::move(*static_cast<Function*>(const_cast<void*>(source))));
+			static_cast<Function*>(const_cast<void*>(source))->~Function();
+			break;
+		case Operation::Copy:
+			new (destination) Function(*static_cast<const Function*>(source));
+			break;
+		case Operation::Destroy:
+			static_cast<Function*>(destination)->~Function();
+			break;
+		}
+	}
+
 	template <typename GameObject, typename Function>
-	std::function<void(SceneNode&, sf::Time)> derivedAction(Function fn)
+	auto derivedAction(Function fn)
 	{
 		return [=](SceneNode& node, sf::Time dt)
 		{
@@ -36,23 +36,37 @@
 
 namespace GEX
 {
-	void CommandQueue::push(const Command & command)
+	CommandQueue::CommandQueue(std::size_t capacity)
+		: buffer_()
+		, head_(0)
+		, count_(0)
 	{
-		queue_.push(command);
+		// keep the capacity a power of two so wrapping is a mask
+		std::size_t size = 1;
+		while (size < capacity)
+			size *= 2;
+
+		buffer_.resize(size);
 	}
 
-	Command CommandQueue::pop()
+	void CommandQueue::push(Command && command)
 	{
-		/*auto cmd = queue_.front();
-		queue_.pop();
-		return cmd;*/
+		if (count_ == buffer_.size())
+			grow();
 
+		buffer_[(head_ + count_) & (buffer_.size() - 1)] = std::move(command);
+		++count_;
+	}
+
+	Command CommandQueue::pop()
+	{
 		Command comm;
 
-		if (!queue_.empty())
+		if (count_ > 0)
 		{
-			comm = queue_.front();
-			queue_.pop();
+			comm = std::move(buffer_[head_]);
+			head_ = (head_ + 1) & (buffer_.size() - 1);
+			--count_;
 		}
 		
 		return comm;
@@ -60,6 +74,28 @@ namespace GEX
 
 	bool CommandQueue::isEmpty() const
 	{
-		return queue_.empty();
+		return count_ == 0;
+	}
+
+	std::size_t CommandQueue::getSize() const
+	{
+		return count_;
+	}
+
+	std::size_t CommandQueue::getCapacity() const
+	{
+		return buffer_.size();
+	}
+
+	void CommandQueue::grow()
+	{
+		std::vector<Command> buffer(buffer_.size() * 2);
+
+		// unwrap the queued commands to the front of the new buffer
+		for (std::size_t i = 0; i < count_; ++i)
+			buffer[i] = std::move(buffer_[(head_ + i) & (buffer_.size() - 1)]);
+
+		buffer_.swap(buffer);
+		head_ = 0;
 	}
 }
\ No newline at end of file
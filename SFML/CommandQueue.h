@@ -35,19 +35,52 @@
 #pragma once
 
 #include "Command.h"
-#include <queue>
+
+#include <vector>
 
 namespace GEX
 { 
+	// Ring buffer of commands. The storage is allocated up front and only grows
+	// (doubling) when a frame queues more commands than ever before.
 	class CommandQueue
 	{
 	public:
-		void				push(const Command& command);
+		explicit			CommandQueue(std::size_t capacity = 64);
+
+		void				push(Command&& command);
 		Command				pop();
 
+			// Hands every command queued so far to callback in one pass. Commands
+			// pushed while draining are kept for the next drain.
+		template <typename Callback>
+		void				drain(Callback callback);
+
 		bool				isEmpty() const;
+		std::size_t			getSize() const;
+		std::size_t			getCapacity() const;
+
+	private:
+		void				grow();
 
 	private:
-		std::queue<Command>	queue_;
+		std::vector<Command>	buffer_;
+		std::size_t				head_;
+		std::size_t				count_;
 	};
+
+	template <typename Callback>
+	void CommandQueue::drain(Callback callback)
+	{
+		std::size_t pending = count_;
+
+		while (pending-- > 0)
+		{
+			// moved out first, so a push from inside the callback may safely grow the buffer
+			Command command(std::move(buffer_[head_]));
+			head_ = (head_ + 1) & (buffer_.size() - 1);
+			--count_;
+
+			callback(command);
+		}
+	}
 }
@@ -36,9 +36,9 @@
 
 namespace GEX
 { 
-	std::map<Aircraft::Type, AircraftData> GEX::initializeAircraftData()
+	AircraftTable GEX::initializeAircraftData()
 	{
-		std::map <Aircraft::Type, AircraftData> data;
+		AircraftTable data;
 
 		data[Aircraft::Type::Eagle].hitpoints = 100;
 		data[Aircraft::Type::Eagle].speed = 200.f;
@@ -74,9 +74,9 @@ namespace GEX
 		return data;
 	}
 
-	std::map<Pickup::Type, PickupData> GEX::initializePickupData()
+	PickupTable GEX::initializePickupData()
 	{
-		std::map <Pickup::Type, PickupData> data;
+		PickupTable data;
 
 		data[Pickup::Type::HealthRefill].texture = TextureID::Entities;
 		data[Pickup::Type::HealthRefill].textureRect = sf::IntRect(0, 64, 40, 40);
@@ -97,19 +97,21 @@ namespace GEX
 		return data;
 	}
 
-	std::map<Projectile::Type, ProjectileData> GEX::initializeProjectileData()
+	ProjectileTable GEX::initializeProjectileData()
 	{
-		std::map <Projectile::Type, ProjectileData> data;
+		ProjectileTable data;
 
 		data[Projectile::Type::AlliedBullet].damage = 10;
 		data[Projectile::Type::AlliedBullet].speed = 300.f;
 		data[Projectile::Type::AlliedBullet].texture = TextureID::Entities;
 		data[Projectile::Type::AlliedBullet].textureRect = sf::IntRect(175, 64, 3, 14);
+		data[Projectile::Type::AlliedBullet].lifetime = sf::seconds(5.f);
 
 		data[Projectile::Type::EnemyBullet].damage = 10;
 		data[Projectile::Type::EnemyBullet].speed = 300.f;
 		data[Projectile::Type::EnemyBullet].texture = TextureID::Entities;
 		data[Projectile::Type::EnemyBullet].textureRect = sf::IntRect(175, 64, 3, 14);
+		data[Projectile::Type::EnemyBullet].lifetime = sf::seconds(5.f);
 
 		data[Projectile::Type::Missile].damage = 200;
 		data[Projectile::Type::Missile].speed = 200.f;
@@ -119,9 +121,9 @@ namespace GEX
 		return data;
 	}
 
-	std::map<Particle::Type, ParticleData> GEX::initializeParticleData()
+	ParticleTable GEX::initializeParticleData()
 	{
-		std::map <Particle::Type, ParticleData> data;
+		ParticleTable data;
 
 		data[Particle::Type::Propellant].color = sf::Color(255, 255, 50);
 		data[Particle::Type::Propellant].lifetime = sf::seconds(0.6f);
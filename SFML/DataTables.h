@@ -43,9 +43,10 @@
 #include <SFML\System\Time.hpp>
 #include <SFML\Graphics\Color.hpp>
 
+#include <array>
+#include <cassert>
+#include <cstddef>
 #include <vector>
-#include <map>
-#include <functional>
 
 namespace GEX
 { 
@@ -78,11 +79,12 @@ namespace GEX
 		float		speed;
 		TextureID	texture;
 		sf::IntRect	textureRect;
+		sf::Time	lifetime;		// bullets only, missiles live until they hit or leave the battlefield
 	};
 
 	struct PickupData
 	{
-		std::function<void(Aircraft&)>	action;
+		void							(*action)(Aircraft&);
 		TextureID						texture;
 		sf::IntRect						textureRect;
 	};
@@ -93,8 +95,50 @@ namespace GEX
 		sf::Time		lifetime;
 	};
 
-	std::map<Pickup::Type, PickupData>			initializePickupData();
-	std::map<Projectile::Type, ProjectileData>	initializeProjectileData();
-	std::map<Aircraft::Type, AircraftData>		initializeAircraftData();
-	std::map<Particle::Type, ParticleData>		initializeParticleData();
+	// Fixed size array indexed by a type enum. The enum's last enumerator is the entry
+	// count, so a lookup is one indexed load instead of a std::map tree walk.
+	template <typename Enum, typename T, Enum Count>
+	class EnumTable
+	{
+	public:
+		static const std::size_t	SIZE = static_cast<std::size_t>(Count);
+
+	public:
+									EnumTable();
+
+		T&							operator[](Enum key);
+		const T&					operator[](Enum key) const;
+
+	private:
+		std::array<T, SIZE>			entries_;
+	};
+
+	using AircraftTable = EnumTable<Aircraft::Type, AircraftData, Aircraft::Type::Count>;
+	using PickupTable = EnumTable<Pickup::Type, PickupData, Pickup::Type::Count>;
+	using ProjectileTable = EnumTable<Projectile::Type, ProjectileData, Projectile::Type::Count>;
+	using ParticleTable = EnumTable<Particle::Type, ParticleData, Particle::Type::ParticleCount>;
+
+	PickupTable					initializePickupData();
+	ProjectileTable				initializeProjectileData();
+	AircraftTable				initializeAircraftData();
+	ParticleTable				initializeParticleData();
+
+	template <typename Enum, typename T, Enum Count>
+	EnumTable<Enum, T, Count>::EnumTable()
+		: entries_()
+	{}
+
+	template <typename Enum, typename T, Enum Count>
+	T& EnumTable<Enum, T, Count>::operator[](Enum key)
+	{
+		assert(static_cast<std::size_t>(key) < SIZE);
+		return entries_[static_cast<std::size_t>(key)];
+	}
+
+	template <typename Enum, typename T, Enum Count>
+	const T& EnumTable<Enum, T, Count>::operator[](Enum key) const
+	{
+		assert(static_cast<std::size_t>(key) < SIZE);
+		return entries_[static_cast<std::size_t>(key)];
+	}
 }
\ No newline at end of file
@@ -65,14 +65,16 @@ namespace GEX
 			command.category = Category::ParticleSystem;
 			command.action = derivedAction<ParticleNode>(finder);
 
-			commands.push(command);
+			commands.push(std::move(command));
 		}
 	}
 
 	void EmitterNode::emitParticle(sf::Time dt)
 	{
 		const float EMISSION_RATE = 30.f;
-		const sf::Time interval = sf::seconds(1.f / EMISSION_RATE);
+
+		// the particle budget turns the rate down while frames run over
+		const sf::Time interval = sf::seconds(1.f / (EMISSION_RATE * particleSystem_->getEmissionScale()));
 
 		accumulatedTime_ += dt;
 
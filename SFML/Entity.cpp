@@ -76,6 +76,9 @@ namespace GEX
 	{
 		assert(points > 0);
 		hitPoints_ -= points;
+
+		if (hitPoints_ <= 0)
+			requestRemovalCheck();
 	}
 
 	void Entity::repair(int points)
@@ -87,6 +90,7 @@ namespace GEX
 	void Entity::destroy()
 	{
 		hitPoints_ = 0;
+		requestRemovalCheck();
 	}
 
 	void Entity::remove()
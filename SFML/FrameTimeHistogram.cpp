@@ -0,0 +1,108 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* FrameTimeHistogram Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#include "FrameTimeHistogram.h"
+
+#include <algorithm>
+
+namespace GEX
+{
+	FrameTimeHistogram::FrameTimeHistogram()
+		: samples_(WINDOW_SIZE, 0)
+		, next_(0)
+		, count_(0)
+		, buckets_(BUCKET_COUNT, 0)
+	{}
+
+	void FrameTimeHistogram::add(sf::Time time)
+	{
+		sf::Int64 microseconds = std::max<sf::Int64>(0, time.asMicroseconds());
+
+		// a full window drops its oldest sample first
+		if (count_ == WINDOW_SIZE)
+			--buckets_[toBucket(samples_[next_])];
+		else
+			++count_;
+
+		samples_[next_] = microseconds;
+		++buckets_[toBucket(microseconds)];
+		next_ = (next_ + 1) % WINDOW_SIZE;
+	}
+
+	FrameTimeHistogram::Percentiles FrameTimeHistogram::getPercentiles() const
+	{
+		Percentiles percentiles = { sf::Time::Zero, sf::Time::Zero, sf::Time::Zero, sf::Time::Zero };
+
+		if (count_ == 0)
+			return percentiles;
+
+		// nearest rank: the smallest sample with at least p% of the window at or below it
+		percentiles.p50 = getPercentile((count_ * 50 + 99) / 100);
+		percentiles.p95 = getPercentile((count_ * 95 + 99) / 100);
+		percentiles.p99 = getPercentile((count_ * 99 + 99) / 100);
+		percentiles.max = sf::microseconds(*std::max_element(samples_.begin(), samples_.begin() + count_));
+
+		// a bucket edge can overshoot the slowest sample
+		percentiles.p50 = std::min(percentiles.p50, percentiles.max);
+		percentiles.p95 = std::min(percentiles.p95, percentiles.max);
+		percentiles.p99 = std::min(percentiles.p99, percentiles.max);
+
+		return percentiles;
+	}
+
+	std::size_t FrameTimeHistogram::getSampleCount() const
+	{
+		return count_;
+	}
+
+	std::size_t FrameTimeHistogram::toBucket(sf::Int64 microseconds) const
+	{
+		return std::min(static_cast<std::size_t>(microseconds / BUCKET_MICROSECONDS), BUCKET_COUNT - 1);
+	}
+
+	sf::Time FrameTimeHistogram::getPercentile(std::size_t rank) const
+	{
+		std::size_t seen = 0;
+
+		for (std::size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+		{
+			seen += buckets_[bucket];
+			if (seen >= rank)
+				return sf::microseconds(static_cast<sf::Int64>(bucket + 1) * BUCKET_MICROSECONDS);
+		}
+
+		return sf::microseconds(static_cast<sf::Int64>(BUCKET_COUNT) * BUCKET_MICROSECONDS);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* FrameTimeHistogram Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#pragma once
+
+#include <SFML/System/Time.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace GEX
+{
+	// Rolling histogram over the last WINDOW_SIZE samples. Times go into fixed 50us
+	// buckets, so adding a sample is O(1) and a percentile is one walk over the
+	// buckets. Percentiles are rounded up to the bucket edge; max is exact.
+	class FrameTimeHistogram
+	{
+	public:
+		static const std::size_t	WINDOW_SIZE = 600;			// ten seconds at 60 fps
+		static const int			BUCKET_MICROSECONDS = 50;
+		static const std::size_t	BUCKET_COUNT = 2000;		// up to 100ms, the last bucket takes anything slower
+
+		struct Percentiles
+		{
+			sf::Time				p50;
+			sf::Time				p95;
+			sf::Time				p99;
+			sf::Time				max;
+		};
+
+	public:
+									FrameTimeHistogram();
+
+		void						add(sf::Time time);
+
+			// all zero while the window is empty
+		Percentiles					getPercentiles() const;
+		std::size_t					getSampleCount() const;
+
+	private:
+		std::size_t					toBucket(sf::Int64 microseconds) const;
+		sf::Time					getPercentile(std::size_t rank) const;
+
+	private:
+		std::vector<sf::Int64>		samples_;
+		std::size_t					next_;
+		std::size_t					count_;
+		std::vector<unsigned int>	buckets_;
+	};
+}
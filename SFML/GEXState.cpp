@@ -36,6 +36,36 @@
 #include "Utility.h"
 #include "CommandQueue.h"
 #include "FontManager.h"
+#include "AllocationTracker.h"
+
+#include <algorithm>
+#include <string>
+
+namespace
+{
+		//last frame's heap traffic and the scopes allocating the most, averaged per frame
+	std::string buildMemoryReport()
+	{
+		if (!GEX::AllocationTracker::isEnabled())
+			return "Allocation tracking is off, build the Benchmark configuration to see it";
+
+		GEX::AllocationTracker::Counters frame = GEX::AllocationTracker::getLastFrame();
+		std::size_t frames = std::max<std::size_t>(1, GEX::AllocationTracker::getFrameCount());
+
+		std::string report = "Last frame: " + std::to_string(frame.allocations) + " allocations, " +
+			std::to_string(frame.frees) + " frees, " + std::to_string(frame.bytesAllocated) + " bytes\n" +
+			"Top scopes (per frame over " + std::to_string(frames) + " frames):";
+
+		for (const GEX::AllocationTracker::Counters& scope : GEX::AllocationTracker::getTopScopes(5))
+		{
+			report += "\n    " + std::string(scope.name) + ": " + std::to_string(scope.allocations / frames) +
+				" allocations, " + std::to_string(scope.frees / frames) + " frees, " +
+				std::to_string(scope.bytesAllocated / frames) + " bytes";
+		}
+
+		return report;
+	}
+}
 
 
 GEXState::GEXState(GEX::StateStack& stateStack, Context context)
@@ -45,6 +75,7 @@ GEXState::GEXState(GEX::StateStack& stateStack, Context context)
 	, stateText_()
 	, instructionsTextReturnToMenu_()
 	, instructionsTextReturnToGame_()
+	, memoryReportText_()
 {
 		//get the texture from the manager, get the font and view size from the context
 	sf::Texture& texture = context.textures->get(GEX::TextureID::GEXStateFace);
@@ -82,6 +113,12 @@ GEXState::GEXState(GEX::StateStack& stateStack, Context context)
 	instructionsTextReturnToMenu_.setString("Press 'Backspace' to Return to the Main Menu");
 	GEX::centerOrigin(instructionsTextReturnToMenu_);
 	instructionsTextReturnToMenu_.setPosition(0.5f * viewSize.x, 0.7f * viewSize.y);
+
+		//the game is frozen while this screen is up, so one snapshot of the memory report is enough
+	memoryReportText_.setFont(GEX::FontManager::getInstance().get(GEX::FontID::Main));
+	memoryReportText_.setString(buildMemoryReport());
+	memoryReportText_.setCharacterSize(16);
+	memoryReportText_.setPosition(0.05f * viewSize.x, 0.77f * viewSize.y);
 }
 
 void GEXState::draw()
@@ -105,6 +142,7 @@ void GEXState::draw()
 	window.draw(stateText_);
 	window.draw(instructionsTextReturnToGame_);
 	window.draw(instructionsTextReturnToMenu_);
+	window.draw(memoryReportText_);
 }
 
 bool GEXState::update(sf::Time dt)
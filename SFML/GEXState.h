@@ -52,5 +52,6 @@ private:
 	sf::Text				stateText_;
 	sf::Text				instructionsTextReturnToMenu_;
 	sf::Text				instructionsTextReturnToGame_;
+	sf::Text				memoryReportText_;
 };
 
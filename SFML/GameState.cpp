@@ -35,11 +35,16 @@
 #include "GameState.h"
 #include "CommandQueue.h"
 
+#include <iostream>
+
 GameState::GameState(GEX::StateStack& stateStack, Context context)
 	: State(stateStack, context)
 	, world_(*context.window)
 	, player_(*context.player)
-{}
+{
+		//every game gets a fresh seed, log it so the run can be told apart and reproduced
+	std::cout << "world seed " << world_.getSeed() << std::endl;
+}
 
 void GameState::draw()
 {
@@ -74,7 +79,8 @@ bool GameState::handleEvent(const sf::Event & event)
 	auto& commands = world_.getCommandQueue();
 	player_.handleEvent(event, commands);
 
-		//'Escape' key brings up pause screen, 'G' key brings up GEX screen, 'Q' key returns player to main menu instantly
+		//'Escape' key brings up pause screen, 'G' key brings up GEX screen, 'Q' key returns player to main menu instantly,
+		//'B' key toggles the debug bounding boxes, 'C' key cycles through the collision broadphases
 	if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape)
 		requestStackPush(GEX::StateID::Pause);
 	else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::G)
@@ -84,6 +90,13 @@ bool GameState::handleEvent(const sf::Event & event)
 		requestStackClear();
 		requestStackPush(GEX::StateID::Menu);
 	}
+	else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::B)
+		GEX::SceneNode::setDrawBoundingBoxes(!GEX::SceneNode::isDrawingBoundingBoxes());
+	else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::C)
+	{
+		int next = (static_cast<int>(world_.getBroadphase()) + 1) % static_cast<int>(GEX::Broadphase::Type::TypeCount);
+		world_.setBroadphase(static_cast<GEX::Broadphase::Type>(next));
+	}
 
 	return true;
 }
\ No newline at end of file
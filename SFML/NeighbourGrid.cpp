@@ -0,0 +1,188 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* NeighbourGrid Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#include "NeighbourGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace GEX
+{
+	const int NeighbourGrid::MAX_CELLS;
+
+	NeighbourGrid::NeighbourGrid(float cellSize)
+		: cellSize_(cellSize)
+		, builtCellSize_(cellSize)
+		, origin_()
+		, columns_(0)
+		, rows_(0)
+		, points_()
+		, sortedPoints_()
+		, cellStarts_()
+		, cellFill_()
+	{}
+
+	void NeighbourGrid::clear()
+	{
+		points_.clear();
+		sortedPoints_.clear();
+		cellStarts_.clear();
+		columns_ = 0;
+		rows_ = 0;
+	}
+
+	void NeighbourGrid::insert(SceneNode& node, sf::Vector2f position)
+	{
+		points_.push_back(Point{ position, &node });
+	}
+
+	void NeighbourGrid::build()
+	{
+		sortedPoints_.resize(points_.size());
+		if (points_.empty())
+		{
+			columns_ = 0;
+			rows_ = 0;
+			return;
+		}
+
+		// the grid only spans the points, so its size follows the battlefield, not the level
+		sf::Vector2f min = points_.front().position;
+		sf::Vector2f max = min;
+		for (const Point& point : points_)
+		{
+			min.x = std::min(min.x, point.position.x);
+			min.y = std::min(min.y, point.position.y);
+			max.x = std::max(max.x, point.position.x);
+			max.y = std::max(max.y, point.position.y);
+		}
+
+		builtCellSize_ = std::max(cellSize_, std::max(max.x - min.x, max.y - min.y) / MAX_CELLS);
+		origin_ = min;
+		columns_ = std::min(MAX_CELLS, static_cast<int>((max.x - min.x) / builtCellSize_) + 1);
+		rows_ = std::min(MAX_CELLS, static_cast<int>((max.y - min.y) / builtCellSize_) + 1);
+
+		// counting sort: size every cell, turn the sizes into start offsets, then scatter
+		cellStarts_.assign(columns_ * rows_ + 1, 0);
+		for (const Point& point : points_)
+			++cellStarts_[toRow(point.position.y) * columns_ + toColumn(point.position.x) + 1];
+
+		for (std::size_t i = 1; i < cellStarts_.size(); ++i)
+			cellStarts_[i] += cellStarts_[i - 1];
+
+		cellFill_.assign(cellStarts_.begin(), cellStarts_.end() - 1);
+		for (const Point& point : points_)
+			sortedPoints_[cellFill_[toRow(point.position.y) * columns_ + toColumn(point.position.x)]++] = point;
+	}
+
+	SceneNode* NeighbourGrid::findNearest(sf::Vector2f position) const
+	{
+		if (columns_ == 0)
+			return nullptr;
+
+		int column = toColumn(position.x);
+		int row = toRow(position.y);
+
+		SceneNode* nearest = nullptr;
+		float nearestDistance = std::numeric_limits<float>::max();
+
+		for (int ring = 0; ; ++ring)
+		{
+			// visit the cells on the border of the (2 ring + 1) square around the query's cell
+			for (int y = std::max(0, row - ring); y <= std::min(rows_ - 1, row + ring); ++y)
+			{
+				bool isEdgeRow = y == row - ring || y == row + ring;
+				int step = isEdgeRow ? 1 : 2 * ring;
+
+				for (int x = column - ring; x <= column + ring; x += std::max(1, step))
+				{
+					if (x < 0 || x >= columns_)
+						continue;
+
+					std::size_t cell = y * columns_ + x;
+					for (std::size_t i = cellStarts_[cell]; i < cellStarts_[cell + 1]; ++i)
+					{
+						sf::Vector2f offset = sortedPoints_[i].position - position;
+						float distance = offset.x * offset.x + offset.y * offset.y;
+
+						if (distance < nearestDistance)
+						{
+							nearestDistance = distance;
+							nearest = sortedPoints_[i].node;
+						}
+					}
+				}
+			}
+
+			// anything in a later ring lies beyond one of the square's sides that still has
+			// cells past it, so at least that far away
+			float bound = std::numeric_limits<float>::max();
+			if (column - ring > 0)
+				bound = std::min(bound, position.x - (origin_.x + (column - ring) * builtCellSize_));
+			if (column + ring < columns_ - 1)
+				bound = std::min(bound, origin_.x + (column + ring + 1) * builtCellSize_ - position.x);
+			if (row - ring > 0)
+				bound = std::min(bound, position.y - (origin_.y + (row - ring) * builtCellSize_));
+			if (row + ring < rows_ - 1)
+				bound = std::min(bound, origin_.y + (row + ring + 1) * builtCellSize_ - position.y);
+
+			// every cell visited
+			if (bound == std::numeric_limits<float>::max())
+				break;
+
+			bound = std::max(0.f, bound);
+			if (nearest && nearestDistance <= bound * bound)
+				break;
+		}
+
+		return nearest;
+	}
+
+	std::size_t NeighbourGrid::getNodeCount() const
+	{
+		return points_.size();
+	}
+
+	int NeighbourGrid::toColumn(float x) const
+	{
+		return std::min(columns_ - 1, std::max(0, static_cast<int>(std::floor((x - origin_.x) / builtCellSize_))));
+	}
+
+	int NeighbourGrid::toRow(float y) const
+	{
+		return std::min(rows_ - 1, std::max(0, static_cast<int>(std::floor((y - origin_.y) / builtCellSize_))));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* NeighbourGrid Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#pragma once
+
+#include <SFML\System\Vector2.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace GEX
+{
+	class SceneNode;
+
+	// Nearest neighbour index over node positions, rebuilt once per tick. Points are
+	// counting sorted into a dense grid; a query searches rings of cells outwards from
+	// its own cell and stops once no unvisited cell can hold anything closer, so it
+	// touches a handful of cells instead of every node.
+	class NeighbourGrid
+	{
+	public:
+			// the grid never gets more than MAX_CELLS cells on a side, cells grow instead
+		static const int		MAX_CELLS = 64;
+
+	public:
+		explicit				NeighbourGrid(float cellSize = 128.f);
+
+		void					clear();
+		void					insert(SceneNode& node, sf::Vector2f position);
+
+			// sorts the inserted points into cells; call once after the inserts, before querying
+		void					build();
+
+			// the node whose inserted position is closest to position, nullptr if there is none
+		SceneNode*				findNearest(sf::Vector2f position) const;
+
+		std::size_t				getNodeCount() const;
+
+	private:
+		struct Point
+		{
+			sf::Vector2f		position;
+			SceneNode*			node;
+		};
+
+		int						toColumn(float x) const;
+		int						toRow(float y) const;
+
+	private:
+		float					cellSize_;
+		float					builtCellSize_;
+		sf::Vector2f			origin_;
+		int						columns_;
+		int						rows_;
+
+		std::vector<Point>		points_;
+		std::vector<Point>		sortedPoints_;
+		std::vector<std::size_t>	cellStarts_;		// sortedPoints_ range of cell i is [cellStarts_[i], cellStarts_[i + 1])
+		std::vector<std::size_t>	cellFill_;			// build() scratch, the next free slot of every cell
+	};
+}
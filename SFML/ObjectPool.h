@@ -0,0 +1,197 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* ObjectPool Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace GEX
+{
+	// Free-list allocator for one object type. Memory is carved out of fixed size
+	// chunks that are never returned, so after warm up creating and destroying an
+	// object is a pointer swap instead of a trip to the heap.
+	// There is one pool per thread, so an object has to be destroyed on the
+	// thread that created it.
+	template <typename T>
+	class ObjectPool
+	{
+	public:
+		static const std::size_t	CHUNK_SIZE = 64;
+
+			// requests served from the free list vs requests that needed a new chunk
+		struct Statistics
+		{
+			std::size_t			hits;
+			std::size_t			misses;
+			std::size_t			inUse;
+			std::size_t			capacity;
+		};
+
+	private:
+								ObjectPool();
+
+	public:
+		static ObjectPool&		getInstance();
+
+								ObjectPool(const ObjectPool&) = delete;
+		ObjectPool&				operator=(const ObjectPool&) = delete;
+
+		template <typename... Args>
+		T*						create(Args&&... args);
+		void					destroy(T* object);
+
+			// adds chunks until count objects fit, so the first of them don't reach the heap
+		void					reserve(std::size_t count);
+
+		Statistics				getStatistics() const;
+		void					resetStatistics();
+
+	private:
+		union Slot
+		{
+			Slot*													next;
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type	storage;
+		};
+
+		void					addChunk();
+
+	private:
+		std::vector<std::unique_ptr<Slot[]>>	chunks_;
+		Slot*									freeList_;
+		Statistics								statistics_;
+	};
+
+	template <typename T>
+	ObjectPool<T>::ObjectPool()
+		: chunks_()
+		, freeList_(nullptr)
+		, statistics_()
+	{}
+
+	template <typename T>
+	ObjectPool<T>& ObjectPool<T>::getInstance()
+	{
+		static thread_local ObjectPool instance;
+		return instance;
+	}
+
+	template <typename T>
+	template <typename... Args>
+	T* ObjectPool<T>::create(Args&&... args)
+	{
+		if (freeList_)
+		{
+			++statistics_.hits;
+		}
+		else
+		{
+			++statistics_.misses;
+			addChunk();
+		}
+
+		Slot* slot = freeList_;
+		freeList_ = slot->next;
+
+		T* object;
+		try
+		{
+			object = new (&slot->storage) T(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			slot->next = freeList_;
+			freeList_ = slot;
+			throw;
+		}
+
+		++statistics_.inUse;
+		return object;
+	}
+
+	template <typename T>
+	void ObjectPool<T>::destroy(T* object)
+	{
+		if (!object)
+			return;
+
+		object->~T();
+
+		// the storage is the first member of the slot, so the addresses match
+		Slot* slot = reinterpret_cast<Slot*>(object);
+		slot->next = freeList_;
+		freeList_ = slot;
+
+		--statistics_.inUse;
+	}
+
+	template <typename T>
+	void ObjectPool<T>::reserve(std::size_t count)
+	{
+		chunks_.reserve((count + CHUNK_SIZE - 1) / CHUNK_SIZE);
+
+		while (statistics_.capacity < count)
+			addChunk();
+	}
+
+	template <typename T>
+	typename ObjectPool<T>::Statistics ObjectPool<T>::getStatistics() const
+	{
+		return statistics_;
+	}
+
+	template <typename T>
+	void ObjectPool<T>::resetStatistics()
+	{
+		statistics_.hits = 0;
+		statistics_.misses = 0;
+	}
+
+	template <typename T>
+	void ObjectPool<T>::addChunk()
+	{
+		std::unique_ptr<Slot[]> chunk(new Slot[CHUNK_SIZE]);
+
+		for (std::size_t i = 0; i < CHUNK_SIZE; ++i)
+			chunk[i].next = (i + 1 < CHUNK_SIZE) ? &chunk[i + 1] : freeList_;
+
+		freeList_ = &chunk[0];
+		chunks_.push_back(std::move(chunk));
+		statistics_.capacity += CHUNK_SIZE;
+	}
+}
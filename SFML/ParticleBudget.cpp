@@ -0,0 +1,166 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* ParticleBudget Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "ParticleBudget.h"
+#include "ParticleNode.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace GEX
+{
+	namespace
+	{
+		// emission backs off quickly when a frame runs long and recovers over a few seconds
+		const float MIN_EMISSION_SCALE = 0.1f;
+		const float EMISSION_BACKOFF = 0.9f;
+		const float EMISSION_RECOVERY = 0.005f;
+	}
+
+	thread_local ParticleBudget::Statistics ParticleBudget::statistics_ = { 0, 0, 1.f, 0 };
+
+	ParticleBudget::ParticleBudget(std::size_t maxParticles, sf::Time frameBudget)
+		: systems_()
+		, maxParticles_(maxParticles)
+		, frameBudget_(frameBudget)
+		, emissionScale_(1.f)
+	{}
+
+	void ParticleBudget::addParticleSystem(ParticleNode& node)
+	{
+		systems_.push_back(&node);
+		node.setParticleBudget(this);
+	}
+
+	void ParticleBudget::update(sf::Time frameTime)
+	{
+		if (frameTime > frameBudget_)
+			emissionScale_ = std::max(MIN_EMISSION_SCALE, emissionScale_ * EMISSION_BACKOFF);
+		else
+			emissionScale_ = std::min(1.f, emissionScale_ + EMISSION_RECOVERY);
+
+		std::size_t count = getParticleCount();
+		if (count > maxParticles_)
+		{
+			cullOldest(count - maxParticles_);
+			count = maxParticles_;
+		}
+
+		statistics_.maxParticles = maxParticles_;
+		statistics_.particleCount = count;
+		statistics_.emissionScale = emissionScale_;
+	}
+
+	float ParticleBudget::getEmissionScale() const
+	{
+		return emissionScale_;
+	}
+
+	void ParticleBudget::setMaxParticles(std::size_t maxParticles)
+	{
+		maxParticles_ = maxParticles;
+	}
+
+	std::size_t ParticleBudget::getMaxParticles() const
+	{
+		return maxParticles_;
+	}
+
+	ParticleBudget::Statistics ParticleBudget::getStatistics()
+	{
+		return statistics_;
+	}
+
+	void ParticleBudget::resetStatistics()
+	{
+		statistics_.culled = 0;
+	}
+
+	std::size_t ParticleBudget::getParticleCount() const
+	{
+		std::size_t count = 0;
+		for (const ParticleNode* node : systems_)
+			count += node->getParticleCount();
+
+		return count;
+	}
+
+	std::size_t ParticleBudget::countOlderThan(float age) const
+	{
+		std::size_t count = 0;
+		for (const ParticleNode* node : systems_)
+			count += node->countOlderThan(age);
+
+		return count;
+	}
+
+	void ParticleBudget::cullOldest(std::size_t count)
+	{
+		statistics_.culled += count;
+
+		// Find the age of the count-th oldest particle over all systems. In every system
+		// the particles that leave fewer than count older ones are a prefix; the youngest
+		// of those, taken over the systems, is that particle.
+		float threshold = std::numeric_limits<float>::max();
+		for (const ParticleNode* node : systems_)
+		{
+			std::size_t first = 0;
+			std::size_t last = node->getParticleCount();
+
+			while (first < last)
+			{
+				std::size_t middle = first + (last - first) / 2;
+				if (countOlderThan(node->getAge(middle)) < count)
+					first = middle + 1;
+				else
+					last = middle;
+			}
+
+			if (first > 0)
+				threshold = std::min(threshold, node->getAge(first - 1));
+		}
+
+		// everything older goes, and particles exactly that old go from the earlier
+		// systems first, the same choice as taking the oldest one at a time
+		std::size_t ties = count - countOlderThan(threshold);
+		for (ParticleNode* node : systems_)
+		{
+			std::size_t older = node->countOlderThan(threshold);
+			std::size_t tied = std::min(node->countOlderThan(threshold, true) - older, ties);
+
+			ties -= tied;
+			node->removeOldest(older + tied);
+		}
+	}
+}
@@ -0,0 +1,91 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* ParticleBudget Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <SFML/System/Time.hpp>
+
+#include <vector>
+
+namespace GEX
+{
+	class ParticleNode;
+
+	// Shared limit for every ParticleNode of a world. Caps the total particle count by
+	// dropping the oldest particles first, and turns emission down while frames run
+	// over budget, back up once they fit again.
+	class ParticleBudget
+	{
+	public:
+		// The last budget updated on the thread, and what it dropped since the reset
+		struct Statistics
+		{
+			std::size_t			maxParticles;
+			std::size_t			particleCount;
+			float				emissionScale;
+			std::size_t			culled;
+		};
+
+	public:
+		explicit				ParticleBudget(std::size_t maxParticles = 20000, sf::Time frameBudget = sf::seconds(1.f / 60.f));
+
+		void					addParticleSystem(ParticleNode& node);
+
+			// once per frame, after the particle systems were updated
+		void					update(sf::Time frameTime);
+
+		float					getEmissionScale() const;
+
+		void					setMaxParticles(std::size_t maxParticles);
+		std::size_t				getMaxParticles() const;
+
+		static Statistics		getStatistics();
+		static void				resetStatistics();
+
+	private:
+		std::size_t				getParticleCount() const;
+		std::size_t				countOlderThan(float age) const;
+		void					cullOldest(std::size_t count);
+
+	private:
+		std::vector<ParticleNode*>	systems_;
+
+		std::size_t					maxParticles_;
+		sf::Time					frameBudget_;
+		float						emissionScale_;
+
+			// per thread, so worlds simulated in parallel don't share counters
+		static thread_local Statistics	statistics_;
+	};
+}
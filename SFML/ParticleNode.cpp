@@ -34,33 +34,52 @@
 
 #include "ParticleNode.h"
 #include "DataTables.h"
+#include "ParticleBudget.h"
+#include "SpriteBatch.h"
+
+#include <algorithm>
+#include <cassert>
 
 namespace GEX
 { 
 	namespace
 	{
-		const std::map<Particle::Type, ParticleData> TABLE = initializeParticleData();
+		const ParticleTable TABLE = initializeParticleData();
+
+		const std::size_t INITIAL_CAPACITY = 256;
 	}
 
 	ParticleNode::ParticleNode(Particle::Type type, const TextureManager& textures)
 		: SceneNode()
-		, particles_()
-		, texture_(textures.get(GEX::TextureID::Particle))
+		, texture_(textures.find(GEX::TextureID::Particle))
+		, textureSize_(textures.getSize(GEX::TextureID::Particle))
 		, type_(type)
+		, color_(TABLE[type].color)
+		, lifetime_(TABLE[type].lifetime.asSeconds())
+		, budget_(nullptr)
+		, positionsX_(INITIAL_CAPACITY)
+		, positionsY_(INITIAL_CAPACITY)
+		, lifetimes_(INITIAL_CAPACITY)
+		, alphas_(INITIAL_CAPACITY)
+		, head_(0)
+		, count_(0)
 		, vertexArray_(sf::Quads)
 		, needsVertexUpdate_(true)
 	{}
 
 	void ParticleNode::addParticle(sf::Vector2f position)
 	{
-		Particle particle;
+		if (count_ == lifetimes_.size())
+			grow();
 
-		particle.position = position;
-		particle.color = TABLE.at(type_).color;
-		particle.lifetime = TABLE.at(type_).lifetime;
+		std::size_t tail = (head_ + count_) & (lifetimes_.size() - 1);
 
-		particles_.push_back(particle);
+		positionsX_[tail] = position.x;
+		positionsY_[tail] = position.y;
+		lifetimes_[tail] = lifetime_;
+		alphas_[tail] = 255;
 
+		++count_;
 	}
 
 	Particle::Type ParticleNode::getParticle() const
@@ -68,20 +87,83 @@ namespace GEX
 		return type_;
 	}
 
+	std::size_t ParticleNode::getParticleCount() const
+	{
+		return count_;
+	}
+
 	unsigned int ParticleNode::getCategory() const
 	{
 		return Category::ParticleSystem;
 	}
 
+	sf::FloatRect ParticleNode::getDrawBounds() const
+	{
+		// particles trail behind every aircraft, wherever their emitters are
+		return UNBOUNDED;
+	}
+
+	void ParticleNode::setParticleBudget(ParticleBudget* budget)
+	{
+		budget_ = budget;
+	}
+
+	float ParticleNode::getEmissionScale() const
+	{
+		return budget_ ? budget_->getEmissionScale() : 1.f;
+	}
+
+	float ParticleNode::getAge(std::size_t n) const
+	{
+		assert(n < count_);
+
+		return lifetime_ - lifetimes_[(head_ + n) & (lifetimes_.size() - 1)];
+	}
+
+	std::size_t ParticleNode::countOlderThan(float age, bool inclusive) const
+	{
+		std::size_t first = 0;
+		std::size_t last = count_;
+
+		while (first < last)
+		{
+			std::size_t middle = first + (last - first) / 2;
+			float middleAge = getAge(middle);
+
+			if (middleAge > age || (inclusive && middleAge == age))
+				first = middle + 1;
+			else
+				last = middle;
+		}
+
+		return first;
+	}
+
+	void ParticleNode::removeOldest(std::size_t count)
+	{
+		count = std::min(count, count_);
+
+		head_ = (head_ + count) & (lifetimes_.size() - 1);
+		count_ -= count;
+		needsVertexUpdate_ = true;
+	}
+
 	void ParticleNode::updateCurrent(sf::Time dt, CommandQueue & commands)
 	{
-		// Remove aged out particles
-		while (!particles_.empty() && particles_.front().lifetime <= sf::Time::Zero)
-			particles_.pop_front();
+		const std::size_t mask = lifetimes_.size() - 1;
+
+		// Remove aged out particles, the oldest are at the head
+		while (count_ > 0 && lifetimes_[head_] <= 0.f)
+		{
+			head_ = (head_ + 1) & mask;
+			--count_;
+		}
 
-		// Count down the particles' lifetime
-		for (Particle& p : particles_)
-			p.lifetime -= dt;
+		// Count down the particles' lifetime, the live range wraps at most once
+		std::size_t end = head_ + count_;
+		ageParticles(head_, std::min(end, lifetimes_.size()), dt.asSeconds());
+		if (end > lifetimes_.size())
+			ageParticles(0, end - lifetimes_.size(), dt.asSeconds());
 
 		// Mark for update
 		needsVertexUpdate_ = true;
@@ -95,42 +177,87 @@ namespace GEX
 			needsVertexUpdate_ = false;
 		}
 		
-		states.texture = &texture_;
+		states.texture = texture_;
 
 		// Draw all the vertices
 		target.draw(vertexArray_, states);
 	}
 
-	void ParticleNode::addVertex(float worldX, float worldY, float texCoordU, float texCoordV, const sf::Color color) const
+	void ParticleNode::batchCurrent(SpriteBatch & batch, sf::RenderStates states) const
+	{
+		// already a single vertex array, drawn in its turn
+		batch.defer(*this, states);
+	}
+
+	void ParticleNode::grow()
+	{
+		const std::size_t capacity = lifetimes_.size();
+
+		// unwrap into the front of arrays twice the size
+		std::rotate(positionsX_.begin(), positionsX_.begin() + head_, positionsX_.end());
+		std::rotate(positionsY_.begin(), positionsY_.begin() + head_, positionsY_.end());
+		std::rotate(lifetimes_.begin(), lifetimes_.begin() + head_, lifetimes_.end());
+		std::rotate(alphas_.begin(), alphas_.begin() + head_, alphas_.end());
+
+		positionsX_.resize(capacity * 2);
+		positionsY_.resize(capacity * 2);
+		lifetimes_.resize(capacity * 2);
+		alphas_.resize(capacity * 2);
+
+		head_ = 0;
+	}
+
+	void ParticleNode::ageParticles(std::size_t begin, std::size_t end, float seconds)
 	{
-		sf::Vertex vertex;
+		float* lifetimes = lifetimes_.data();
+		std::uint8_t* alphas = alphas_.data();
 
-		vertex.position = sf::Vector2f(worldX, worldY);
-		vertex.texCoords = sf::Vector2f(texCoordU, texCoordV);
-		vertex.color = color;
+		const float alphaScale = 255.f / lifetime_;
 
-		vertexArray_.append(vertex);
+		// plain arithmetic over contiguous floats, the compiler vectorizes this
+		for (std::size_t i = begin; i < end; ++i)
+		{
+			float lifetime = lifetimes[i] - seconds;
+			lifetimes[i] = lifetime;
+			alphas[i] = static_cast<std::uint8_t>(std::max(lifetime, 0.f) * alphaScale);
+		}
 	}
 
 	void ParticleNode::computeVertices() const
 	{
-		sf::Vector2f size(texture_.getSize());
-		sf::Vector2f half = size / 2.f;
+		const sf::Vector2f size(textureSize_);
+		const sf::Vector2f half = size / 2.f;
+		const std::size_t mask = lifetimes_.size() - 1;
 
-		// Refill vertex array
-		vertexArray_.clear();
-		for (const Particle& p : particles_)
+		// Refill vertex array; resizing keeps its storage, so this does not allocate once warmed up
+		vertexArray_.resize(count_ * 4);
+		if (count_ == 0)
+			return;
+
+		sf::Vertex* vertex = &vertexArray_[0];
+		for (std::size_t n = 0; n < count_; ++n, vertex += 4)
 		{
-			sf::Vector2f pos = p.position;
-			sf::Color color = p.color;
+			std::size_t i = (head_ + n) & mask;
+			float x = positionsX_[i];
+			float y = positionsY_[i];
+
+			sf::Color color = color_;
+			color.a = alphas_[i];
+
+			vertex[0].position = sf::Vector2f(x - half.x, y - half.y);
+			vertex[1].position = sf::Vector2f(x + half.x, y - half.y);
+			vertex[2].position = sf::Vector2f(x + half.x, y + half.y);
+			vertex[3].position = sf::Vector2f(x - half.x, y + half.y);
 
-			float ratio = p.lifetime.asSeconds() / TABLE.at(type_).lifetime.asSeconds();
-			color.a = static_cast<sf::Uint8>(255 * std::max(ratio, 0.f));
+			vertex[0].texCoords = sf::Vector2f(0.f, 0.f);
+			vertex[1].texCoords = sf::Vector2f(size.x, 0.f);
+			vertex[2].texCoords = sf::Vector2f(size.x, size.y);
+			vertex[3].texCoords = sf::Vector2f(0.f, size.y);
 
-			addVertex(pos.x - half.x, pos.y - half.y, 0.f, 0.f, color);
-			addVertex(pos.x + half.x, pos.y - half.y, size.x, 0.f, color);
-			addVertex(pos.x + half.x, pos.y + half.y, size.x, size.y, color);
-			addVertex(pos.x - half.x, pos.y + half.y, 0.f, size.y, color);
+			vertex[0].color = color;
+			vertex[1].color = color;
+			vertex[2].color = color;
+			vertex[3].color = color;
 		}
 	}
 }
\ No newline at end of file
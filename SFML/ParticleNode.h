@@ -40,10 +40,16 @@
 #include "Particle.h"
 #include "TextureManager.h"
 
-#include <deque>
+#include <cstdint>
+#include <vector>
 
 namespace GEX
 { 
+	class ParticleBudget;
+
+	// Particles of one type, kept as parallel arrays in a ring buffer. Every particle
+	// of a node lives equally long, so the oldest is always at the head and expiring
+	// is just moving the head forward.
 	class ParticleNode : public SceneNode
 	{
 	public:
@@ -51,19 +57,43 @@ namespace GEX
 
 		void				addParticle(sf::Vector2f position);
 		Particle::Type		getParticle() const;
+		std::size_t			getParticleCount() const;
 		unsigned int		getCategory() const override;
+		sf::FloatRect		getDrawBounds() const override;
+
+		void				setParticleBudget(ParticleBudget* budget);
+		float				getEmissionScale() const;
+
+			// age of the n-th oldest particle, 0 being the oldest; ages only fall from
+			// there, so the particles older than any age are a prefix
+		float				getAge(std::size_t n) const;
+		std::size_t			countOlderThan(float age, bool inclusive = false) const;
+		void				removeOldest(std::size_t count);
 
 	private:
 		void				updateCurrent(sf::Time dt, CommandQueue& commands) override;
 		void				drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		void				batchCurrent(SpriteBatch& batch, sf::RenderStates states) const override;
 
-		void				addVertex(float worldX, float worldY, float texCoordU, float texCoordV, const sf::Color color) const;
+		void				grow();
+		void				ageParticles(std::size_t begin, std::size_t end, float seconds);
 		void				computeVertices() const;
 
 	private:
-		std::deque<Particle>	particles_;
-		const sf::Texture&		texture_;
+		const sf::Texture*		texture_;
+		sf::Vector2u			textureSize_;
 		Particle::Type			type_;
+		sf::Color				color_;
+		float					lifetime_;
+		ParticleBudget*			budget_;
+
+			// ring buffer, capacity is a power of two
+		std::vector<float>			positionsX_;
+		std::vector<float>			positionsY_;
+		std::vector<float>			lifetimes_;
+		std::vector<std::uint8_t>	alphas_;
+		std::size_t					head_;
+		std::size_t					count_;
 
 		mutable	sf::VertexArray vertexArray_;
 		mutable bool			needsVertexUpdate_;
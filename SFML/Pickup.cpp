@@ -35,18 +35,19 @@
 #include "Pickup.h"
 #include "DataTables.h"
 #include "Utility.h"
+#include "SpriteBatch.h"
 
 namespace GEX
 { 
 	namespace
 	{
-		const std::map<Pickup::Type, PickupData> TABLE = initializePickupData();
+		const PickupTable TABLE = initializePickupData();
 	}
 
 	Pickup::Pickup(Type type, const TextureManager& textures)
 		: Entity(1)
 		, type_(type)
-		, sprite_(textures.get(TABLE.at(type).texture), TABLE.at(type).textureRect)
+		, sprite_(textures.makeSprite(TABLE[type].texture, TABLE[type].textureRect))
 	{
 		centerOrigin(sprite_);
 	}
@@ -60,10 +61,14 @@ namespace GEX
 	}
 	void Pickup::apply(Aircraft & player)
 	{
-		TABLE.at(type_).action(player);
+		TABLE[type_].action(player);
 	}
 	void Pickup::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
 	{
 		target.draw(sprite_, states);
 	}
+	void Pickup::batchCurrent(SpriteBatch & batch, sf::RenderStates states) const
+	{
+		batch.add(sprite_, states.transform);
+	}
 }
\ No newline at end of file
@@ -62,6 +62,7 @@ namespace GEX
 
 	private:
 		void			drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		void			batchCurrent(SpriteBatch& batch, sf::RenderStates states) const override;
 
 	private:
 		Type			type_;
@@ -98,7 +98,7 @@ namespace GEX
 
 			if (found != keyBindings_.end())
 			{
-				commands.push(actionBindings_[found->second]);
+				commands.push(actionBindings_[found->second].clone());
 			}
 		}
 	}
@@ -110,7 +110,7 @@ namespace GEX
 		{
 			if (sf::Keyboard::isKeyPressed(pair.first) && isRealTimeAction(pair.second))
 			{
-				commands.push(actionBindings_[pair.second]);
+				commands.push(actionBindings_[pair.second].clone());
 			}
 		}
 	}
@@ -0,0 +1,155 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Profiler Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#include "Profiler.h"
+
+#include <fstream>
+
+namespace GEX
+{
+	Profiler::Profiler()
+		: isEnabled_(false)
+		, epoch_(Clock::now())
+		, mutex_()
+		, threadLogs_()
+	{}
+
+	Profiler& Profiler::getInstance()
+	{
+		static Profiler instance;
+		return instance;
+	}
+
+	void Profiler::setEnabled(bool flag)
+	{
+		isEnabled_ = flag;
+	}
+
+	bool Profiler::isEnabled() const
+	{
+		return isEnabled_;
+	}
+
+	void Profiler::record(const char* name, Clock::time_point start, Clock::time_point end)
+	{
+		// each thread appends to its own log, so no lock is taken per event
+		ThreadLog& log = getThreadLog();
+
+		if (log.events.size() < MAX_EVENTS_PER_THREAD)
+			log.events.push_back(Event{ name, start, end });
+	}
+
+	void Profiler::clear()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		for (auto& log : threadLogs_)
+			log->events.clear();
+
+		epoch_ = Clock::now();
+	}
+
+	bool Profiler::writeChromeTrace(const std::string& path) const
+	{
+		std::ofstream out(path);
+		if (!out)
+			return false;
+
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		// complete ("X") events, timestamps in microseconds since the epoch
+		out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+		bool first = true;
+		for (const auto& log : threadLogs_)
+		{
+			for (const Event& event : log->events)
+			{
+				if (!first)
+					out << ',';
+				first = false;
+
+				out << "\n{\"name\":\"" << event.name
+					<< "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << log->threadId
+					<< ",\"ts\":" << std::chrono::duration<double, std::micro>(event.start - epoch_).count()
+					<< ",\"dur\":" << std::chrono::duration<double, std::micro>(event.end - event.start).count() << '}';
+			}
+		}
+
+		out << "\n]}\n";
+
+		return static_cast<bool>(out);
+	}
+
+	Profiler::ThreadLog& Profiler::getThreadLog()
+	{
+		thread_local ThreadLog* threadLog = nullptr;
+
+		if (!threadLog)
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+
+			threadLogs_.emplace_back(new ThreadLog{ threadLogs_.size() + 1, std::vector<Event>() });
+			threadLog = threadLogs_.back().get();
+			threadLog->events.reserve(4096);
+		}
+
+		return *threadLog;
+	}
+
+	ProfileScope::ProfileScope(const char* name)
+		: name_(name)
+		, start_()
+		, isRecording_(Profiler::getInstance().isEnabled())
+		, previousAllocationScope_(0)
+	{
+#if GEX_ALLOCATION_TRACKING
+		previousAllocationScope_ = AllocationTracker::enterScope(name);
+#endif
+
+		if (isRecording_)
+			start_ = Profiler::Clock::now();
+	}
+
+	ProfileScope::~ProfileScope()
+	{
+		if (isRecording_)
+			Profiler::getInstance().record(name_, start_, Profiler::Clock::now());
+
+#if GEX_ALLOCATION_TRACKING
+		AllocationTracker::leaveScope(previousAllocationScope_);
+#endif
+	}
+}
\ No newline at end of file
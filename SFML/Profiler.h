@@ -0,0 +1,141 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Profiler Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#pragma once
+
+#include "AllocationTracker.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Profiling is on in debug builds, and in release builds that define GEX_ENABLE_PROFILING.
+// Allocation tracking needs the scopes too. Otherwise GEX_PROFILE_SCOPE expands to
+// nothing and costs nothing.
+#if defined(GEX_ENABLE_PROFILING) || defined(_DEBUG)
+#define GEX_PROFILING 1
+#else
+#define GEX_PROFILING 0
+#endif
+
+#define GEX_PROFILE_CONCAT_(a, b) a##b
+#define GEX_PROFILE_CONCAT(a, b) GEX_PROFILE_CONCAT_(a, b)
+
+#if GEX_PROFILING || GEX_ALLOCATION_TRACKING
+	// times the rest of the enclosing block and counts its allocations; name must be a string literal
+#define GEX_PROFILE_SCOPE(name) GEX::ProfileScope GEX_PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#else
+#define GEX_PROFILE_SCOPE(name) ((void)0)
+#endif
+
+namespace GEX
+{
+	// Collects timed scopes from any number of threads and writes them as a Chrome
+	// trace (chrome://tracing, or ui.perfetto.dev). Scopes nest, so the trace shows
+	// the call hierarchy per thread. Recording is off until setEnabled(true).
+	class Profiler
+	{
+	public:
+		typedef std::chrono::steady_clock	Clock;
+
+			// a thread stops recording once it holds this many events
+		static const std::size_t	MAX_EVENTS_PER_THREAD = 1 << 20;
+
+		struct Event
+		{
+			const char*				name;
+			Clock::time_point		start;
+			Clock::time_point		end;
+		};
+
+	private:
+									Profiler();
+
+	public:
+		static Profiler&			getInstance();
+
+									Profiler(const Profiler&) = delete;
+		Profiler&					operator=(const Profiler&) = delete;
+
+		void						setEnabled(bool flag);
+		bool						isEnabled() const;
+
+		void						record(const char* name, Clock::time_point start, Clock::time_point end);
+
+			// clear() and writeChromeTrace() must not run while other threads are still
+			// recording, the batch runner joins its workers first
+		void						clear();
+
+			// returns false if the file can't be written
+		bool						writeChromeTrace(const std::string& path) const;
+
+	private:
+		struct ThreadLog
+		{
+			std::size_t				threadId;
+			std::vector<Event>		events;
+		};
+
+			// created on a thread's first event and kept until exit, the thread only holds a pointer
+		ThreadLog&					getThreadLog();
+
+	private:
+		std::atomic<bool>			isEnabled_;
+		Clock::time_point			epoch_;
+
+		mutable std::mutex			mutex_;
+		std::vector<std::unique_ptr<ThreadLog>>	threadLogs_;
+	};
+
+	class ProfileScope
+	{
+	public:
+		explicit					ProfileScope(const char* name);
+									~ProfileScope();
+
+									ProfileScope(const ProfileScope&) = delete;
+		ProfileScope&				operator=(const ProfileScope&) = delete;
+
+	private:
+		const char*					name_;
+		Profiler::Clock::time_point	start_;
+		bool						isRecording_;
+		std::size_t					previousAllocationScope_;
+	};
+}
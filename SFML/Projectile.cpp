@@ -37,28 +37,29 @@
 #include "Category.h"
 #include "DataTables.h"
 #include "EmitterNode.h"
+#include "SpriteBatch.h"
 
 namespace GEX
 { 
 	namespace
 	{
-		const std::map<Projectile::Type, ProjectileData> TABLE = initializeProjectileData();
+		const ProjectileTable TABLE = initializeProjectileData();
 	}
 
 	GEX::Projectile::Projectile(Type type, const TextureManager & textures)
 		: Entity(1)
 		, type_(type)
-		, sprite_(textures.get(TABLE.at(type).texture), TABLE.at(type).textureRect)
+		, sprite_(textures.makeSprite(TABLE[type].texture, TABLE[type].textureRect))
 	{
 		centerOrigin(sprite_);
 
 		if (isGuided())
 		{
-			std::unique_ptr<EmitterNode> smoke(new EmitterNode(Particle::Type::Smoke));
+			auto smoke = makePooledNode<EmitterNode>(Particle::Type::Smoke);
 			smoke->setPosition(0.f, Projectile::getBoundingBox().height / 2.f);
 			attachChild(std::move(smoke));
 
-			std::unique_ptr<EmitterNode> propellant(new EmitterNode(Particle::Type::Propellant));
+			auto propellant = makePooledNode<EmitterNode>(Particle::Type::Propellant);
 			propellant->setPosition(0.f, Projectile::getBoundingBox().height / 2.f);
 			attachChild(std::move(propellant));
 		}
@@ -74,12 +75,12 @@ namespace GEX
 
 	float GEX::Projectile::getMaxSpeed() const
 	{
-		return TABLE.at(type_).speed;
+		return TABLE[type_].speed;
 	}
 
 	int GEX::Projectile::getDamage() const
 	{
-		return TABLE.at(type_).damage;
+		return TABLE[type_].damage;
 	}
 
 	bool Projectile::isGuided() const
@@ -120,4 +121,9 @@ namespace GEX
 	{
 		target.draw(sprite_, states);
 	}
+
+	void Projectile::batchCurrent(SpriteBatch & batch, sf::RenderStates states) const
+	{
+		batch.add(sprite_, states.transform);
+	}
 }
\ No newline at end of file
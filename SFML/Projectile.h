@@ -47,7 +47,8 @@ namespace GEX
 		{
 			AlliedBullet,
 			EnemyBullet,
-			Missile
+			Missile,
+			Count
 		};
 
 	public:
@@ -69,6 +70,7 @@ namespace GEX
 
 	private:
 		void				drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		void				batchCurrent(SpriteBatch& batch, sf::RenderStates states) const override;
 
 	private:
 		Type				type_;
@@ -0,0 +1,102 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Random Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#include "Random.h"
+
+#include <cassert>
+#include <random>
+
+namespace GEX
+{
+	namespace
+	{
+		const std::uint64_t MULTIPLIER = 6364136223846793005ULL;
+		const std::uint64_t INCREMENT = 1442695040888963407ULL;
+	}
+
+	Random::Random(std::uint64_t seed)
+		: seed_(0)
+		, state_(0)
+	{
+		this->seed(seed);
+	}
+
+	std::uint64_t Random::makeSeed()
+	{
+		std::random_device device;
+		return (static_cast<std::uint64_t>(device()) << 32) | device();
+	}
+
+	void Random::seed(std::uint64_t seed)
+	{
+		// standard PCG seeding, so nearby seeds still give unrelated streams
+		seed_ = seed;
+		state_ = 0;
+		next();
+		state_ += seed;
+		next();
+	}
+
+	std::uint64_t Random::getSeed() const
+	{
+		return seed_;
+	}
+
+	std::uint32_t Random::next()
+	{
+		std::uint64_t state = state_;
+		state_ = state * MULTIPLIER + INCREMENT;
+
+		// xorshift the high bits down, then rotate by the top five bits
+		std::uint32_t xorShifted = static_cast<std::uint32_t>(((state >> 18) ^ state) >> 27);
+		std::uint32_t rotation = static_cast<std::uint32_t>(state >> 59);
+
+		return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+	}
+
+	int Random::nextInt(int exclusiveMax)
+	{
+		assert(exclusiveMax > 0);
+
+		// multiply and keep the high half instead of %, no division on the hot path
+		return static_cast<int>((static_cast<std::uint64_t>(next()) * static_cast<std::uint64_t>(exclusiveMax)) >> 32);
+	}
+
+	float Random::nextFloat()
+	{
+		// the top 24 bits fill a float mantissa exactly
+		return (next() >> 8) * (1.f / 16777216.f);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* Random Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#pragma once
+
+#include <cstdint>
+
+namespace GEX
+{
+	// Small PCG32 generator: 8 bytes of state and a few instructions per number.
+	// Every World owns one, so the same seed and the same input replay the same game.
+	class Random
+	{
+	public:
+		explicit				Random(std::uint64_t seed);
+
+			// a fresh seed from std::random_device, for games that don't need to be replayed
+		static std::uint64_t	makeSeed();
+
+		void					seed(std::uint64_t seed);
+		std::uint64_t			getSeed() const;
+
+		std::uint32_t			next();
+
+			// uniform in [0, exclusiveMax)
+		int						nextInt(int exclusiveMax);
+			// uniform in [0, 1)
+		float					nextFloat();
+
+	private:
+		std::uint64_t			seed_;
+		std::uint64_t			state_;
+	};
+}
@@ -46,6 +46,24 @@ namespace GEX
 		FinishLine
 	};
 
+	// The textures a World loads. Headless worlds make no textures and keep only these
+	// sizes, so they must match the PNG files; update them whenever an image changes.
+	struct WorldTexture
+	{
+		TextureID		id;
+		const char*		file;
+		unsigned int	width;
+		unsigned int	height;
+	};
+
+	const WorldTexture WORLD_TEXTURES[] = {
+		{ TextureID::Entities,		"Media/Textures/Entities.png",		288,	104 },
+		{ TextureID::Jungle,		"Media/Textures/JungleBig.png",		1024,	1024 },
+		{ TextureID::Particle,		"Media/Textures/Particle.png",		19,		19 },
+		{ TextureID::Explosion,		"Media/Textures/Explosion.png",		1024,	1024 },
+		{ TextureID::FinishLine,	"Media/Textures/FinishLine.png",	1024,	76 }
+	};
+
 	enum class FontID {
 		Main
 	};
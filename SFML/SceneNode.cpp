@@ -34,27 +34,119 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 
 #include "SceneNode.h"
+#include "CategoryRegistry.h"
+#include "CollisionMatrix.h"
+#include "CollisionPairs.h"
+#include "SpriteBatch.h"
 #include "Category.h"
 #include "Command.h"
 #include "Utility.h"
 
 namespace GEX
 { 
+	namespace
+	{
+		bool hasArea(const sf::FloatRect& rect)
+		{
+			return rect.width > 0.f && rect.height > 0.f;
+		}
+
+		sf::FloatRect unite(const sf::FloatRect& lhs, const sf::FloatRect& rhs)
+		{
+			if (!hasArea(lhs))
+				return rhs;
+			if (!hasArea(rhs))
+				return lhs;
+
+			float left = std::min(lhs.left, rhs.left);
+			float top = std::min(lhs.top, rhs.top);
+			float right = std::max(lhs.left + lhs.width, rhs.left + rhs.width);
+			float bottom = std::max(lhs.top + lhs.height, rhs.top + rhs.height);
+
+			return sf::FloatRect(left, top, right - left, bottom - top);
+		}
+	}
+
+	// a quarter of the float range each way, so edges and unions stay finite
+	const sf::FloatRect SceneNode::UNBOUNDED(-std::numeric_limits<float>::max() / 4.f, -std::numeric_limits<float>::max() / 4.f,
+											 std::numeric_limits<float>::max() / 2.f, std::numeric_limits<float>::max() / 2.f);
+
+	thread_local SceneNode::TransformStatistics SceneNode::transformStatistics_ = { 0, 0 };
+	thread_local SceneNode::DrawStatistics SceneNode::drawStatistics_ = { 0, 0 };
+	bool SceneNode::drawBoundingBoxes_ = false;
+	thread_local std::uint64_t SceneNode::nextId_ = 0;
+	thread_local std::vector<std::vector<SceneNode::Ptr>> SceneNode::spareChildLists_;
+
+	SceneNode::Deleter::Deleter(Release release)
+		: release(release)
+	{}
+
+	void SceneNode::Deleter::operator()(SceneNode* node) const
+	{
+		if (release)
+			release(node);
+		else
+			delete node;
+	}
+
 	SceneNode::SceneNode(Category::Type category)
-		: children_()
-		, parent_(nullptr)
+		: parent_(nullptr)
+		, children_()
 		, category_(category)
+		, id_(nextId_++)
+		, worldTransform_()
+		, isWorldTransformDirty_(true)
+		, drawBounds_()
+		, subtreeBounds_()
+		, subtreeSize_(1)
+		, registry_(nullptr)
+		, registeredCategory_(Category::None)
+		, registryBucket_(0)
+		, registrySlot_(0)
+		, pendingRemovals_()
+		, isRemovalPending_(false)
+		, isRemovalCandidate_(false)
 	{}
 
+	SceneNode::~SceneNode()
+	{
+		// the children go first, so their lists are spare before this one
+		children_.clear();
+
+		if (children_.capacity() > 0 && spareChildLists_.size() < MAX_SPARE_CHILD_LISTS)
+			spareChildLists_.push_back(std::move(children_));
+	}
+
 	void SceneNode::attachChild(Ptr child)
 	{
+		if (children_.capacity() == 0 && !spareChildLists_.empty())
+		{
+			children_.swap(spareChildLists_.back());
+			spareChildLists_.pop_back();
+		}
+
 		child->parent_ = this;
+		child->invalidateWorldTransform();
+
+		if (registry_)
+			child->registerSubtree(registry_);
+
+		SceneNode* node = child.get();
 		children_.push_back(std::move(child));
+
+		if (node->isRemovalCandidate_ || !node->pendingRemovals_.empty())
+			node->markRemovalPending();
+	}
+
+	void SceneNode::reserveChildren(std::size_t count)
+	{
+		children_.reserve(count);
 	}
 
 	SceneNode::Ptr SceneNode::detachChild(const SceneNode& node)
@@ -71,6 +163,16 @@ namespace GEX
 		Ptr result = std::move(*found);
 		children_.erase(found);
 
+		if (result->isRemovalPending_)
+		{
+			pendingRemovals_.erase(std::find(pendingRemovals_.begin(), pendingRemovals_.end(), result.get()));
+			result->isRemovalPending_ = false;
+		}
+
+		result->parent_ = nullptr;
+		result->invalidateWorldTransform();
+		result->unregisterSubtree();
+
 		return result;
 	}
 
@@ -79,14 +181,119 @@ namespace GEX
 		return getWorldTransform() * sf::Vector2f();
 	}
 
-	sf::Transform SceneNode::getWorldTransform() const
+	const sf::Transform& SceneNode::getWorldTransform() const
+	{
+		if (!isWorldTransformDirty_)
+		{
+			++transformStatistics_.reused;
+			return worldTransform_;
+		}
+
+		// the parent's cached transform already holds the rest of the chain
+		if (parent_)
+			worldTransform_ = parent_->getWorldTransform() * getTransform();
+		else
+			worldTransform_ = getTransform();
+
+		isWorldTransformDirty_ = false;
+		++transformStatistics_.recomputed;
+
+		return worldTransform_;
+	}
+
+	void SceneNode::setPosition(float x, float y)
+	{
+		sf::Transformable::setPosition(x, y);
+		invalidateWorldTransform();
+	}
+
+	void SceneNode::setPosition(const sf::Vector2f & position)
+	{
+		sf::Transformable::setPosition(position);
+		invalidateWorldTransform();
+	}
+
+	void SceneNode::setRotation(float angle)
+	{
+		sf::Transformable::setRotation(angle);
+		invalidateWorldTransform();
+	}
+
+	void SceneNode::setScale(float factorX, float factorY)
+	{
+		sf::Transformable::setScale(factorX, factorY);
+		invalidateWorldTransform();
+	}
+
+	void SceneNode::setScale(const sf::Vector2f & factors)
+	{
+		sf::Transformable::setScale(factors);
+		invalidateWorldTransform();
+	}
+
+	void SceneNode::setOrigin(float x, float y)
+	{
+		sf::Transformable::setOrigin(x, y);
+		invalidateWorldTransform();
+	}
+
+	void SceneNode::setOrigin(const sf::Vector2f & origin)
+	{
+		sf::Transformable::setOrigin(origin);
+		invalidateWorldTransform();
+	}
+
+	void SceneNode::move(float offsetX, float offsetY)
+	{
+		sf::Transformable::move(offsetX, offsetY);
+		invalidateWorldTransform();
+	}
+
+	void SceneNode::move(const sf::Vector2f & offset)
+	{
+		sf::Transformable::move(offset);
+		invalidateWorldTransform();
+	}
+
+	void SceneNode::rotate(float angle)
 	{
-		sf::Transform transform = sf::Transform::Identity;
+		sf::Transformable::rotate(angle);
+		invalidateWorldTransform();
+	}
+
+	void SceneNode::scale(float factorX, float factorY)
+	{
+		sf::Transformable::scale(factorX, factorY);
+		invalidateWorldTransform();
+	}
+
+	void SceneNode::scale(const sf::Vector2f & factor)
+	{
+		sf::Transformable::scale(factor);
+		invalidateWorldTransform();
+	}
 
-		for (const SceneNode* node = this; node != nullptr; node = node->parent_)
-			transform = node->getTransform() * transform;
+	SceneNode::TransformStatistics SceneNode::getTransformStatistics()
+	{
+		return transformStatistics_;
+	}
 
-		return transform;
+	void SceneNode::resetTransformStatistics()
+	{
+		transformStatistics_ = { 0, 0 };
+	}
+
+	void SceneNode::invalidateWorldTransform()
+	{
+		// a node is only ever clean if its whole parent chain is, so a dirty
+		// node's subtree is already dirty and the walk can stop here
+		if (isWorldTransformDirty_)
+			return;
+
+		isWorldTransformDirty_ = true;
+
+		for (Ptr& child : children_)
+			child->invalidateWorldTransform();
 	}
 
 	sf::FloatRect SceneNode::getBoundingBox() const
@@ -94,6 +301,61 @@ namespace GEX
 		return sf::FloatRect();
 	}
 
+	sf::FloatRect SceneNode::getDrawBounds() const
+	{
+		return getBoundingBox();
+	}
+
+	void SceneNode::updateDrawBounds()
+	{
+		drawBounds_ = getDrawBounds();
+		subtreeBounds_ = drawBounds_;
+		subtreeSize_ = 1;
+
+		for (Ptr& child : children_)
+		{
+			child->updateDrawBounds();
+			subtreeBounds_ = unite(subtreeBounds_, child->subtreeBounds_);
+			subtreeSize_ += child->subtreeSize_;
+		}
+	}
+
+	SceneNode::DrawStatistics SceneNode::getDrawStatistics()
+	{
+		return drawStatistics_;
+	}
+
+	void SceneNode::resetDrawStatistics()
+	{
+		drawStatistics_ = { 0, 0 };
+	}
+
+	void SceneNode::reserveSpareChildLists(std::size_t count, std::size_t capacity)
+	{
+		count = std::min(count, MAX_SPARE_CHILD_LISTS);
+		spareChildLists_.reserve(MAX_SPARE_CHILD_LISTS);
+
+		// lists left by an earlier scene on this thread may be too small
+		for (std::vector<Ptr>& children : spareChildLists_)
+			children.reserve(capacity);
+
+		while (spareChildLists_.size() < count)
+		{
+			spareChildLists_.emplace_back();
+			spareChildLists_.back().reserve(capacity);
+		}
+	}
+
+	void SceneNode::setDrawBoundingBoxes(bool flag)
+	{
+		drawBoundingBoxes_ = flag;
+	}
+
+	bool SceneNode::isDrawingBoundingBoxes()
+	{
+		return drawBoundingBoxes_;
+	}
+
 	void SceneNode::drawBoundingBox(sf::RenderTarget & target, sf::RenderStates states) const
 	{
 		sf::FloatRect rect = getBoundingBox();
@@ -120,27 +382,86 @@ namespace GEX
 
 	void SceneNode::removeWrecks()
 	{
-		auto wreckFieldBegin = std::remove_if(children_.begin(), children_.end(), std::mem_fn(&SceneNode::isMarkedForRemoval));
-		children_.erase(wreckFieldBegin, children_.end());
+		if (pendingRemovals_.empty())
+			return;
+
+		// nodes put back on the list while we walk it land behind count
+		const std::size_t count = pendingRemovals_.size();
+		bool hasWrecks = false;
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			SceneNode* node = pendingRemovals_[i];
+			node->isRemovalPending_ = false;
+
+			if (node->isRemovalCandidate_ && node->isMarkedForRemoval())
+			{
+				// the erase below destroys the wreck, so take it out of the registry first
+				node->unregisterSubtree();
+				hasWrecks = true;
+			}
+			else
+			{
+				node->removeWrecks();
+
+				// e.g. an aircraft that is still exploding
+				if (node->isRemovalCandidate_)
+					node->markRemovalPending();
+			}
+		}
+
+		pendingRemovals_.erase(pendingRemovals_.begin(), pendingRemovals_.begin() + count);
+
+		if (hasWrecks)
+		{
+			auto wreckFieldBegin = std::remove_if(children_.begin(), children_.end(), 
+				[](const Ptr& child) { return child->isRemovalCandidate_ && child->isMarkedForRemoval(); });
+			children_.erase(wreckFieldBegin, children_.end());
+		}
+	}
+
+	void SceneNode::requestRemovalCheck()
+	{
+		isRemovalCandidate_ = true;
+		markRemovalPending();
+	}
 
-		std::for_each(children_.begin(), children_.end(), std::mem_fn(&SceneNode::removeWrecks));
+	void SceneNode::markRemovalPending()
+	{
+		// stops at the first node that is already on its parent's list, the rest
+		// of the path above it is flagged too
+		for (SceneNode* node = this; node->parent_ && !node->isRemovalPending_; node = node->parent_)
+		{
+			node->isRemovalPending_ = true;
+			node->parent_->pendingRemovals_.push_back(node);
+		}
 	}
 
-	void SceneNode::checkSceneCollision(SceneNode & node, std::set<Pair>& collisionPair)
+	void SceneNode::checkSceneCollision(SceneNode & node, const CollisionMatrix& matrix, CollisionPairs& collisionPairs)
 	{
-		checkNodeCollision(node, collisionPair);
+		checkNodeCollision(node, matrix, collisionPairs);
 
 		for (Ptr& c : node.children_)
-			checkSceneCollision(*c, collisionPair);
+			checkSceneCollision(*c, matrix, collisionPairs);
 	}
 
-	void SceneNode::checkNodeCollision(SceneNode & node, std::set<Pair>& collisionPair)
+	void SceneNode::checkNodeCollision(SceneNode & node, const CollisionMatrix& matrix, CollisionPairs& collisionPairs)
 	{
-		if (this != &node && collision(*this, node) && !isDestroyed() && !node.isDestroyed())
-			collisionPair.insert(std::minmax(this, &node));
+		// categories first, they are a lot cheaper than two bounding boxes
+		if (this != &node && matrix.accepts(getCategory(), node.getCategory()) && collision(*this, node) && !isDestroyed() && !node.isDestroyed())
+			collisionPairs.insert(*this, node);
 
 		for (Ptr& c : children_)
-			c->checkNodeCollision(node, collisionPair);
+			c->checkNodeCollision(node, matrix, collisionPairs);
+	}
+
+	void SceneNode::collectNodes(unsigned int category, std::vector<SceneNode*>& nodes)
+	{
+		if (getCategory() & category)
+			nodes.push_back(this);
+
+		for (Ptr& c : children_)
+			c->collectNodes(category, nodes);
 	}
 
 	void SceneNode::update(sf::Time dt, CommandQueue& commands)
@@ -164,6 +485,46 @@ namespace GEX
 		return category_;
 	}
 
+	std::uint64_t SceneNode::getId() const
+	{
+		return id_;
+	}
+
+	void SceneNode::setCategoryRegistry(CategoryRegistry* registry)
+	{
+		unregisterSubtree();
+
+		if (registry)
+			registerSubtree(registry);
+	}
+
+	void SceneNode::registerSubtree(CategoryRegistry* registry)
+	{
+		registry_ = registry;
+
+		// categories never change after construction, so they are read once here
+		registeredCategory_ = getCategory();
+		if (registeredCategory_ != Category::None)
+			registry_->add(*this);
+
+		for (Ptr& child : children_)
+			child->registerSubtree(registry);
+	}
+
+	void SceneNode::unregisterSubtree()
+	{
+		if (!registry_)
+			return;
+
+		if (registeredCategory_ != Category::None)
+			registry_->remove(*this);
+
+		registry_ = nullptr;
+
+		for (Ptr& child : children_)
+			child->unregisterSubtree();
+	}
+
 	void SceneNode::updateCurrent(sf::Time dt, CommandQueue& commands)
 	{
 		//default to do nothing.
@@ -179,12 +540,32 @@ namespace GEX
 
 	void SceneNode::draw(sf::RenderTarget & target, sf::RenderStates states) const
 	{
+		const sf::View& view = target.getView();
+		sf::FloatRect viewBounds(view.getCenter() - view.getSize() / 2.f, view.getSize());
+
+		// nothing in this subtree is on screen
+		if (hasArea(subtreeBounds_) && !viewBounds.intersects(subtreeBounds_))
+		{
+			drawStatistics_.culled += subtreeSize_;
+			return;
+		}
+
 		states.transform *= getTransform();
 
-		drawCurrent(target, states);
+		if (!hasArea(drawBounds_) || viewBounds.intersects(drawBounds_))
+		{
+			drawCurrent(target, states);
+			++drawStatistics_.drawn;
+		}
+		else
+		{
+			++drawStatistics_.culled;
+		}
+
 		drawChildren(target, states);
 
-		drawBoundingBox(target, states);
+		if (drawBoundingBoxes_)
+			drawBoundingBox(target, states);
 	}
 
 	void SceneNode::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
@@ -199,6 +580,42 @@ namespace GEX
 			child->draw(target, states);
 		}
 	}
+
+	void SceneNode::batchCurrent(SpriteBatch & batch, sf::RenderStates states) const
+	{
+		// draws nothing of its own; nodes that do hand the batch their quads, text or
+		// themselves, so plain nodes like layers don't split the batch's runs
+	}
+
+	void SceneNode::drawBatched(SpriteBatch & batch, sf::RenderStates states, const sf::FloatRect& viewBounds) const
+	{
+		if (hasArea(subtreeBounds_) && !viewBounds.intersects(subtreeBounds_))
+		{
+			drawStatistics_.culled += subtreeSize_;
+			return;
+		}
+
+		states.transform *= getTransform();
+
+		if (!hasArea(drawBounds_) || viewBounds.intersects(drawBounds_))
+		{
+			batchCurrent(batch, states);
+			++drawStatistics_.drawn;
+		}
+		else
+		{
+			++drawStatistics_.culled;
+		}
+
+		for (const Ptr& child : children_)
+		{
+			child->drawBatched(batch, states, viewBounds);
+		}
+
+		sf::FloatRect rect = getBoundingBox();
+		if (drawBoundingBoxes_ && hasArea(rect))
+			batch.addOutline(rect, sf::Color::Cyan, 1.f);
+	}
 	
 	float distance(const SceneNode & lhs, const SceneNode & rhs)
 	{
@@ -39,12 +39,13 @@
 #include <SFML\System\Time.hpp>
 
 #include <vector>
+#include <cstdint>
 #include <memory>
-#include <set>
 
 #include "Command.h"
 #include "Category.h"
 #include "CommandQueue.h"
+#include "ObjectPool.h"
 
 // forward declarations
 struct Command;
@@ -52,57 +53,206 @@ class CommandQueue;
 
 namespace GEX
 { 
+	class CategoryRegistry;
+	class CollisionMatrix;
+	class CollisionPairs;
+	class SpriteBatch;
+
 	class SceneNode : public sf::Transformable, public sf::Drawable
 	{	
 	public:
-		using Ptr = std::unique_ptr<SceneNode>;
+			// Plain nodes are deleted, pooled nodes are handed back to their pool.
+			// Converts from std::default_delete so std::unique_ptr<Derived> still
+			// attaches as before.
+		struct Deleter
+		{
+			using Release = void(*)(SceneNode* node);
+
+								Deleter(Release release = nullptr);
+			template <typename U>
+								Deleter(const std::default_delete<U>&);
+
+			void				operator()(SceneNode* node) const;
+
+			Release				release;
+		};
+
+		using Ptr = std::unique_ptr<SceneNode, Deleter>;
 		using Pair = std::pair<SceneNode*, SceneNode*>;
 
+		// How often getWorldTransform() had to walk the parent chain and how often
+		// the cached matrix could be handed out instead
+		struct TransformStatistics
+		{
+			std::size_t			recomputed;
+			std::size_t			reused;
+		};
+
+		// Nodes drawn and nodes skipped because they were outside the view
+		struct DrawStatistics
+		{
+			std::size_t			drawn;
+			std::size_t			culled;
+		};
+
 	public:
 								SceneNode(Category::Type category = Category::Type::None);
-		virtual					~SceneNode() = default;
+		virtual					~SceneNode();
 								SceneNode(const SceneNode&) = delete;
 								SceneNode& operator=(SceneNode&) = delete;
 
 		void					attachChild(Ptr child);
 		Ptr						detachChild(const SceneNode& node);
+		void					reserveChildren(std::size_t count);
 
 		void					update(sf::Time dt, CommandQueue& commands);
 		void					onCommand(const Command& command, sf::Time dt);
 		virtual unsigned int	getCategory() const;
 
+			// unique per thread and increasing in creation order, so ordering nodes by
+			// id gives the same order on every run, unlike ordering them by address
+		std::uint64_t			getId() const;
+
+		void					setCategoryRegistry(CategoryRegistry* registry);
+
 		sf::Vector2f			getWorldPosition() const;
-		sf::Transform			getWorldTransform() const;
+		const sf::Transform&	getWorldTransform() const;
+
+			// hide the sf::Transformable setters so every local change invalidates
+			// the cached world transform of this subtree
+		void					setPosition(float x, float y);
+		void					setPosition(const sf::Vector2f& position);
+		void					setRotation(float angle);
+		void					setScale(float factorX, float factorY);
+		void					setScale(const sf::Vector2f& factors);
+		void					setOrigin(float x, float y);
+		void					setOrigin(const sf::Vector2f& origin);
+		void					move(float offsetX, float offsetY);
+		void					move(const sf::Vector2f& offset);
+		void					rotate(float angle);
+		void					scale(float factorX, float factorY);
+		void					scale(const sf::Vector2f& factor);
+
+		static TransformStatistics	getTransformStatistics();
+		static void					resetTransformStatistics();
 
 		virtual sf::FloatRect	getBoundingBox() const;
 		void					drawBoundingBox(sf::RenderTarget& target, sf::RenderStates states) const;
 
+			// world space area the node draws into. An empty rect means it draws nothing
+			// of its own. A node that draws but can't tell where returns UNBOUNDED, so
+			// neither it nor any subtree holding it is ever culled.
+		virtual sf::FloatRect	getDrawBounds() const;
+		static const sf::FloatRect	UNBOUNDED;
+
+			// caches the draw bounds of every node and subtree, once per frame after update
+		void					updateDrawBounds();
+
+		static DrawStatistics	getDrawStatistics();
+		static void				resetDrawStatistics();
+
+			// fills the calling thread's spare child lists up to count and makes every one
+			// able to take capacity children, so the first nodes to attach children don't
+			// reach the heap
+		static void				reserveSpareChildLists(std::size_t count, std::size_t capacity);
+
+		static void				setDrawBoundingBoxes(bool flag);
+		static bool				isDrawingBoundingBoxes();
+
+			// same traversal as draw(), but quads go into the batch to be drawn per texture
+		void					drawBatched(SpriteBatch& batch, sf::RenderStates states, const sf::FloatRect& viewBounds) const;
+
 		virtual bool			isDestroyed() const;
 		virtual bool			isMarkedForRemoval() const;
 
+			// visits only the paths below nodes that asked for a check, so an idle tick
+			// costs nothing; surviving children keep their order
 		void					removeWrecks();
 
-		void					checkSceneCollision(SceneNode& node, std::set<Pair>& collisionPair);
-		void					checkNodeCollision(SceneNode& node, std::set<Pair>& collisionPair);
+		void					checkSceneCollision(SceneNode& node, const CollisionMatrix& matrix, CollisionPairs& collisionPairs);
+		void					checkNodeCollision(SceneNode& node, const CollisionMatrix& matrix, CollisionPairs& collisionPairs);
+
+		void					collectNodes(unsigned int category, std::vector<SceneNode*>& nodes);
 
 	protected:
 			//update the tree
 		virtual void			updateCurrent(sf::Time dt, CommandQueue& commands);
 		void					updateChildren(sf::Time dt, CommandQueue& commands);
+
+			// call whenever isMarkedForRemoval() may have become true; the node is
+			// then checked by every removeWrecks() pass until it is gone
+		void					requestRemovalCheck();
 			
 	private:
 			//draw the tree
 		void					draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 		virtual void			drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const;
 		void					drawChildren(sf::RenderTarget& target, sf::RenderStates states) const;
+			// does nothing, override it along with drawCurrent
+		virtual void			batchCurrent(SpriteBatch& batch, sf::RenderStates states) const;
+
+		void					invalidateWorldTransform();
+
+		void					registerSubtree(CategoryRegistry* registry);
+		void					unregisterSubtree();
+
+		void					markRemovalPending();
+
+		friend class			CategoryRegistry;
+		friend class			SpriteBatch;
 		
 	private:
 		SceneNode *				parent_;
 		std::vector<Ptr>		children_;
 
+			// child lists of destroyed nodes, handed to the next node that attaches a
+			// child, so pooled nodes created over and over don't grow a fresh list each time
+		static const std::size_t	MAX_SPARE_CHILD_LISTS = 256;
+		static thread_local std::vector<std::vector<Ptr>>	spareChildLists_;
+
 		Category::Type			category_;
+		std::uint64_t			id_;
+		static thread_local std::uint64_t	nextId_;
+
+		mutable sf::Transform	worldTransform_;
+		mutable bool			isWorldTransformDirty_;
+
+			// per thread, so worlds simulated in parallel don't share counters
+		static thread_local TransformStatistics	transformStatistics_;
+
+		sf::FloatRect			drawBounds_;
+		sf::FloatRect			subtreeBounds_;
+		std::size_t				subtreeSize_;
+
+		static thread_local DrawStatistics	drawStatistics_;
+		static bool				drawBoundingBoxes_;
+
+		CategoryRegistry*		registry_;
+		unsigned int			registeredCategory_;
+		std::size_t				registryBucket_;
+		std::size_t				registrySlot_;
+
+			// children that are removal candidates or lead to one
+		std::vector<SceneNode*>	pendingRemovals_;
+		bool					isRemovalPending_;
+		bool					isRemovalCandidate_;
 	};
 
+	template <typename U>
+	SceneNode::Deleter::Deleter(const std::default_delete<U>&)
+		: release(nullptr)
+	{}
+
+	// Builds a node in the free list of ObjectPool<T>; the returned pointer
+	// gives the memory back to the pool when the node is removed.
+	template <typename T, typename... Args>
+	std::unique_ptr<T, SceneNode::Deleter> makePooledNode(Args&&... args)
+	{
+		return std::unique_ptr<T, SceneNode::Deleter>(
+			ObjectPool<T>::getInstance().create(std::forward<Args>(args)...),
+			SceneNode::Deleter([](SceneNode* node) { ObjectPool<T>::getInstance().destroy(static_cast<T*>(node)); }));
+	}
+
 	float distance(const SceneNode& lhs, const SceneNode& rhs);
 	bool collision(const SceneNode& lhs, const SceneNode& rhs);
 }
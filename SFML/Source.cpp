@@ -34,9 +34,59 @@
 
 #include <SFML/Graphics.hpp>
 #include "Application.h"
-int main()
+#include "BatchRunner.h"
+#include "Benchmark.h"
+#include "Profiler.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[])
 {
+	// "--benchmark [name] [results.csv]" runs the benchmarks instead of the game
+	if (argc > 1 && std::string(argv[1]) == "--benchmark")
+		return GEX::runBenchmarks(argc > 2 ? argv[2] : "all", argc > 3 ? argv[3] : "");
+
+	// "--batch [runs] [ticks] [scripted|auto] [file.csv] [threads] [seed]" plays headless matches in parallel
+	if (argc > 1 && std::string(argv[1]) == "--batch")
+		return GEX::runBatch(argc, argv);
+
+	// "--trace [file.json]" records a Chrome trace of the session, open it in ui.perfetto.dev
+	// "--frame-csv [file.csv]" writes the update, render and frame time of every frame
+	std::string tracePath;
+	std::string frameCsvPath;
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string option(argv[i]);
+		bool hasValue = i + 1 < argc && std::string(argv[i + 1]).compare(0, 2, "--") != 0;
+
+		if (option == "--trace")
+			tracePath = hasValue ? argv[++i] : "trace.json";
+		else if (option == "--frame-csv")
+			frameCsvPath = hasValue ? argv[++i] : "frames.csv";
+	}
+
+	if (!tracePath.empty())
+	{
+		if (!GEX_PROFILING)
+			std::cerr << "profiling is compiled out, build with GEX_ENABLE_PROFILING to record a trace" << std::endl;
+
+		GEX::Profiler::getInstance().setEnabled(true);
+	}
+
 	Application app;
 
+	if (!frameCsvPath.empty() && !app.openFrameLog(frameCsvPath))
+	{
+		std::cerr << "cannot write '" << frameCsvPath << "'" << std::endl;
+		return 1;
+	}
+
 	app.run();
+
+	if (!tracePath.empty() && !GEX::Profiler::getInstance().writeChromeTrace(tracePath))
+	{
+		std::cerr << "cannot write '" << tracePath << "'" << std::endl;
+		return 1;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,144 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* SpatialHash Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#include "SpatialHash.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace GEX
+{
+	SpatialHash::SpatialHash(float cellSize)
+		: cellSize_(cellSize)
+		, entries_()
+		, cells_()
+		, occupiedCells_()
+	{
+		assert(cellSize_ > 0.f);
+	}
+
+	void SpatialHash::clear()
+	{
+		// keep the buckets around so a rebuild every tick does not reallocate them
+		for (CellKey key : occupiedCells_)
+			cells_[key].clear();
+
+		occupiedCells_.clear();
+		entries_.clear();
+	}
+
+	void SpatialHash::insert(SceneNode& node)
+	{
+		sf::FloatRect bounds = node.getBoundingBox();
+
+		std::size_t index = entries_.size();
+		entries_.push_back({ &node, bounds, node.getCategory() });
+
+		int minX = toCell(bounds.left);
+		int minY = toCell(bounds.top);
+		int maxX = toCell(bounds.left + bounds.width);
+		int maxY = toCell(bounds.top + bounds.height);
+
+		for (int y = minY; y <= maxY; ++y)
+		{
+			for (int x = minX; x <= maxX; ++x)
+			{
+				std::vector<std::size_t>& cell = cells_[toCellKey(x, y)];
+
+				if (cell.empty())
+					occupiedCells_.push_back(toCellKey(x, y));
+
+				cell.push_back(index);
+			}
+		}
+	}
+
+	void SpatialHash::update(const std::vector<SceneNode*>& nodes)
+	{
+		clear();
+		for (SceneNode* node : nodes)
+			insert(*node);
+	}
+
+	void SpatialHash::findPairs(const CollisionMatrix& matrix, CollisionPairs& collisionPairs) const
+	{
+		for (CellKey key : occupiedCells_)
+		{
+			const std::vector<std::size_t>& cell = cells_.at(key);
+
+			for (std::size_t i = 0; i < cell.size(); ++i)
+			{
+				const Entry& lhs = entries_[cell[i]];
+
+				for (std::size_t j = i + 1; j < cell.size(); ++j)
+				{
+					const Entry& rhs = entries_[cell[j]];
+
+					// a pair sharing several cells is reported more than once, build() folds them
+					if (matrix.accepts(lhs.category, lhs.bounds, rhs.category, rhs.bounds))
+						collisionPairs.insert(*lhs.node, *rhs.node);
+				}
+			}
+		}
+
+		collisionPairs.build();
+	}
+
+	bool SpatialHash::query(const sf::FloatRect& area, const Broadphase::Visitor& visitor) const
+	{
+		return query<const Broadphase::Visitor&>(area, visitor);
+	}
+
+	std::size_t SpatialHash::getNodeCount() const
+	{
+		return entries_.size();
+	}
+
+	float SpatialHash::getCellSize() const
+	{
+		return cellSize_;
+	}
+
+	SpatialHash::CellKey SpatialHash::toCellKey(int x, int y) const
+	{
+		return (static_cast<CellKey>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+	}
+
+	int SpatialHash::toCell(float coordinate) const
+	{
+		return static_cast<int>(std::floor(coordinate / cellSize_));
+	}
+}
\ No newline at end of file
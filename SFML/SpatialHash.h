@@ -0,0 +1,123 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* SpatialHash Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#pragma once
+
+#include <SFML\Graphics\Rect.hpp>
+
+#include "Broadphase.h"
+#include "SceneNode.h"
+#include "CollisionMatrix.h"
+#include "CollisionPairs.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace GEX
+{
+	// Uniform grid broadphase. Every inserted node is bucketed into the cells its
+	// bounding box overlaps, so only nodes sharing a cell are tested against each other.
+	class SpatialHash : public Broadphase
+	{
+	public:
+		explicit				SpatialHash(float cellSize = 64.f);
+
+		void					clear();
+		void					insert(SceneNode& node);
+
+		void					update(const std::vector<SceneNode*>& nodes) override;
+
+			// pairs the matrix turns away are never bounds tested; builds collisionPairs
+			// once they are all in
+		void					findPairs(const CollisionMatrix& matrix, CollisionPairs& collisionPairs) const override;
+
+			// Calls visitor(node, bounds) for the nodes sharing a cell with area, until it
+			// returns true. A node spanning several of those cells can be visited more than once.
+		template <typename Function>
+		bool					query(const sf::FloatRect& area, Function visitor) const;
+		bool					query(const sf::FloatRect& area, const Broadphase::Visitor& visitor) const override;
+
+		std::size_t				getNodeCount() const override;
+		float					getCellSize() const;
+
+	private:
+		using CellKey = std::uint64_t;
+
+		struct Entry
+		{
+			SceneNode*			node;
+			sf::FloatRect		bounds;
+			unsigned int		category;
+		};
+
+		CellKey					toCellKey(int x, int y) const;
+		int						toCell(float coordinate) const;
+
+	private:
+		float													cellSize_;
+		std::vector<Entry>										entries_;
+		std::unordered_map<CellKey, std::vector<std::size_t>>	cells_;
+		std::vector<CellKey>									occupiedCells_;
+	};
+
+	template <typename Function>
+	bool SpatialHash::query(const sf::FloatRect& area, Function visitor) const
+	{
+		if (entries_.empty())
+			return false;
+
+		int maxX = toCell(area.left + area.width);
+		int maxY = toCell(area.top + area.height);
+
+		for (int y = toCell(area.top); y <= maxY; ++y)
+		{
+			for (int x = toCell(area.left); x <= maxX; ++x)
+			{
+				auto cell = cells_.find(toCellKey(x, y));
+				if (cell == cells_.end())
+					continue;
+
+				for (std::size_t index : cell->second)
+				{
+					if (visitor(*entries_[index].node, entries_[index].bounds))
+						return true;
+				}
+			}
+		}
+
+		return false;
+	}
+}
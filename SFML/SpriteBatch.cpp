@@ -0,0 +1,129 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* SpriteBatch Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "SpriteBatch.h"
+#include "SceneNode.h"
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+#include <cstdlib>
+
+namespace GEX
+{
+	SpriteBatch::SpriteBatch()
+		: vertices_()
+		, runs_()
+		, texts_()
+	{}
+
+	void SpriteBatch::add(const sf::Sprite& sprite, const sf::Transform& transform)
+	{
+		const sf::IntRect& textureRect = sprite.getTextureRect();
+		sf::FloatRect rect(0.f, 0.f, static_cast<float>(std::abs(textureRect.width)), static_cast<float>(std::abs(textureRect.height)));
+
+		add(sprite.getTexture(), rect, sf::FloatRect(textureRect), transform * sprite.getTransform(), sprite.getColor());
+	}
+
+	void SpriteBatch::add(const sf::Text& text, const sf::RenderStates& states)
+	{
+		if (!text.getString().isEmpty())
+			texts_.push_back({ &text, states });
+	}
+
+	void SpriteBatch::add(const sf::Texture* texture, const sf::FloatRect& rect, const sf::FloatRect& textureRect, 
+						  const sf::Transform& transform, sf::Color color)
+	{
+		// only a quad right after one of the same texture can join its draw call,
+		// merging any further would change what is drawn over what
+		if (runs_.empty() || runs_.back().node || runs_.back().texture != texture)
+			runs_.push_back({ texture, vertices_.size(), 0, nullptr, sf::RenderStates::Default });
+
+		float right = rect.left + rect.width;
+		float bottom = rect.top + rect.height;
+		float u2 = textureRect.left + textureRect.width;
+		float v2 = textureRect.top + textureRect.height;
+
+		vertices_.push_back(sf::Vertex(transform.transformPoint(rect.left, rect.top), color, sf::Vector2f(textureRect.left, textureRect.top)));
+		vertices_.push_back(sf::Vertex(transform.transformPoint(right, rect.top), color, sf::Vector2f(u2, textureRect.top)));
+		vertices_.push_back(sf::Vertex(transform.transformPoint(right, bottom), color, sf::Vector2f(u2, v2)));
+		vertices_.push_back(sf::Vertex(transform.transformPoint(rect.left, bottom), color, sf::Vector2f(textureRect.left, v2)));
+		runs_.back().count += 4;
+	}
+
+	void SpriteBatch::addOutline(const sf::FloatRect& rect, sf::Color color, float thickness)
+	{
+		const sf::FloatRect none;
+		const sf::Transform identity;
+		float right = rect.left + rect.width;
+		float bottom = rect.top + rect.height;
+
+		// four untextured bars around the outside of rect, like a shape outline
+		add(nullptr, sf::FloatRect(rect.left - thickness, rect.top - thickness, rect.width + 2 * thickness, thickness), none, identity, color);
+		add(nullptr, sf::FloatRect(rect.left - thickness, bottom, rect.width + 2 * thickness, thickness), none, identity, color);
+		add(nullptr, sf::FloatRect(rect.left - thickness, rect.top, thickness, rect.height), none, identity, color);
+		add(nullptr, sf::FloatRect(right, rect.top, thickness, rect.height), none, identity, color);
+	}
+
+	void SpriteBatch::defer(const SceneNode& node, const sf::RenderStates& states)
+	{
+		runs_.push_back({ nullptr, 0, 0, &node, states });
+	}
+
+	void SpriteBatch::flush(sf::RenderTarget& target)
+	{
+		for (const Run& run : runs_)
+		{
+			if (run.node)
+			{
+				run.node->drawCurrent(target, run.states);
+				continue;
+			}
+
+			sf::RenderStates states;
+			states.texture = run.texture;
+
+			target.draw(vertices_.data() + run.first, run.count, sf::Quads, states);
+		}
+
+		// labels go over the sprites they belong to
+		for (const TextEntry& entry : texts_)
+			target.draw(*entry.text, entry.states);
+
+		vertices_.clear();
+		runs_.clear();
+		texts_.clear();
+	}
+}
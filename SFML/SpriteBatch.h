@@ -0,0 +1,98 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* SpriteBatch Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <vector>
+
+namespace sf
+{
+	class RenderTarget;
+	class Sprite;
+	class Text;
+	class Texture;
+}
+
+namespace GEX
+{
+	class SceneNode;
+
+	// Collects textured quads while the scene is traversed and, on flush, draws every
+	// run of consecutive quads sharing a texture with a single call. Nodes that are not
+	// made of quads are drawn as usual in their turn, after the quads submitted before
+	// them. Text is drawn through sf::Text in one pass on top of everything else.
+	class SpriteBatch
+	{
+	public:
+									SpriteBatch();
+
+		void						add(const sf::Sprite& sprite, const sf::Transform& transform);
+		void						add(const sf::Text& text, const sf::RenderStates& states);
+		void						add(const sf::Texture* texture, const sf::FloatRect& rect, const sf::FloatRect& textureRect,
+										const sf::Transform& transform, sf::Color color);
+
+		void						addOutline(const sf::FloatRect& rect, sf::Color color, float thickness);
+		void						defer(const SceneNode& node, const sf::RenderStates& states);
+
+		void						flush(sf::RenderTarget& target);
+
+	private:
+		struct Run
+		{
+			const sf::Texture*			texture;
+			std::size_t					first;		// the run's quads are vertices_[first, first + count)
+			std::size_t					count;
+			const SceneNode*			node;		// or, when set, a node drawn as usual in its turn
+			sf::RenderStates			states;
+		};
+
+		struct TextEntry
+		{
+			const sf::Text*				text;
+			sf::RenderStates			states;
+		};
+
+	private:
+			// kept between frames so the storage is reused
+		std::vector<sf::Vertex>		vertices_;
+		std::vector<Run>			runs_;
+		std::vector<TextEntry>		texts_;
+	};
+}
@@ -33,6 +33,7 @@
 */
 
 #include "SpriteNode.h"
+#include "SpriteBatch.h"
 #include <SFML\Graphics.hpp>
 
 
@@ -44,8 +45,21 @@ namespace GEX
 	SpriteNode::SpriteNode(const sf::Texture & texture, const sf::IntRect & textureRect) : sprite_(texture, textureRect)
 	{}
 
+	SpriteNode::SpriteNode(const sf::Sprite & sprite) : sprite_(sprite)
+	{}
+
+	sf::FloatRect SpriteNode::getDrawBounds() const
+	{
+		return getWorldTransform().transformRect(sprite_.getGlobalBounds());
+	}
+
 	void SpriteNode::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
 	{
 		target.draw(sprite_, states);
 	}
+
+	void SpriteNode::batchCurrent(SpriteBatch & batch, sf::RenderStates states) const
+	{
+		batch.add(sprite_, states.transform);
+	}
 }
\ No newline at end of file
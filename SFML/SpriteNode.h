@@ -44,9 +44,13 @@ namespace GEX
 	public:
 		explicit		 SpriteNode(const sf::Texture& texture);
 						 SpriteNode(const sf::Texture& texture, const sf::IntRect& textureRect);
+		explicit		 SpriteNode(const sf::Sprite& sprite);
+
+		sf::FloatRect	 getDrawBounds() const override;
 
 	private:
 		virtual void	 drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		virtual void	 batchCurrent(SpriteBatch& batch, sf::RenderStates states) const override;
 
 	private:
 		sf::Sprite		 sprite_;
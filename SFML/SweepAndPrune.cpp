@@ -0,0 +1,193 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* SweepAndPrune Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#include "SweepAndPrune.h"
+#include "CollisionMatrix.h"
+#include "CollisionPairs.h"
+#include "SceneNode.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace GEX
+{
+	namespace
+	{
+		const std::uint64_t NO_ID = std::numeric_limits<std::uint64_t>::max();
+		const std::size_t NO_ENTRY = std::numeric_limits<std::size_t>::max();
+
+		// ids are handed out in sequence, so spread them before masking
+		std::size_t hashId(std::uint64_t id)
+		{
+			return static_cast<std::size_t>((id * 0x9E3779B97F4A7C15ull) >> 32);
+		}
+	}
+
+	SweepAndPrune::SweepAndPrune()
+		: entries_()
+		, slots_()
+		, newcomers_()
+		, stamp_(0)
+		, maxHeight_(0.f)
+	{}
+
+	void SweepAndPrune::update(const std::vector<SceneNode*>& nodes)
+	{
+		++stamp_;
+		newcomers_.clear();
+
+		// refresh the entries of nodes that were here last tick, in place
+		for (SceneNode* node : nodes)
+		{
+			std::size_t index = findEntry(node->getId());
+
+			if (index != NO_ENTRY && entries_[index].stamp != stamp_)
+			{
+				Entry& entry = entries_[index];
+				entry.node = node;
+				entry.bounds = node->getBoundingBox();
+				entry.bottom = entry.bounds.top + entry.bounds.height;
+				entry.stamp = stamp_;
+			}
+			else
+			{
+				newcomers_.push_back(node);
+			}
+		}
+
+		// entries nobody claimed belong to nodes that are gone, possibly deleted
+		entries_.erase(std::remove_if(entries_.begin(), entries_.end(), [this](const Entry& entry) { return entry.stamp != stamp_; }), 
+					   entries_.end());
+
+		for (SceneNode* node : newcomers_)
+		{
+			sf::FloatRect bounds = node->getBoundingBox();
+			entries_.push_back({ node, node->getId(), bounds, bounds.top + bounds.height, node->getCategory(), stamp_ });
+		}
+
+		// nearly sorted already, so each entry only moves a few places
+		maxHeight_ = 0.f;
+		for (std::size_t i = 0; i < entries_.size(); ++i)
+		{
+			Entry entry = entries_[i];
+			std::size_t j = i;
+
+			for (; j > 0 && entries_[j - 1].bounds.top > entry.bounds.top; --j)
+				entries_[j] = entries_[j - 1];
+
+			entries_[j] = entry;
+			maxHeight_ = std::max(maxHeight_, entry.bounds.height);
+		}
+
+		rebuildSlots();
+	}
+
+	void SweepAndPrune::findPairs(const CollisionMatrix& matrix, CollisionPairs& collisionPairs) const
+	{
+		for (std::size_t i = 0; i < entries_.size(); ++i)
+		{
+			const Entry& lhs = entries_[i];
+
+			// everything further on starts below lhs
+			for (std::size_t j = i + 1; j < entries_.size() && entries_[j].bounds.top <= lhs.bottom; ++j)
+			{
+				const Entry& rhs = entries_[j];
+
+				if (matrix.accepts(lhs.category, lhs.bounds, rhs.category, rhs.bounds))
+					collisionPairs.insert(*lhs.node, *rhs.node);
+			}
+		}
+
+		collisionPairs.build();
+	}
+
+	bool SweepAndPrune::query(const sf::FloatRect& area, const Visitor& visitor) const
+	{
+		// no box is taller than maxHeight_, so none starting above this can reach area
+		float first = area.top - maxHeight_;
+		float bottom = area.top + area.height;
+
+		auto begin = std::lower_bound(entries_.begin(), entries_.end(), first, 
+									  [](const Entry& entry, float top) { return entry.bounds.top < top; });
+
+		for (auto entry = begin; entry != entries_.end() && entry->bounds.top <= bottom; ++entry)
+		{
+			if (entry->bottom >= area.top && visitor(*entry->node, entry->bounds))
+				return true;
+		}
+
+		return false;
+	}
+
+	std::size_t SweepAndPrune::getNodeCount() const
+	{
+		return entries_.size();
+	}
+
+	std::size_t SweepAndPrune::findEntry(std::uint64_t id) const
+	{
+		if (slots_.empty())
+			return NO_ENTRY;
+
+		const std::size_t mask = slots_.size() - 1;
+		for (std::size_t slot = hashId(id) & mask; slots_[slot].id != NO_ID; slot = (slot + 1) & mask)
+		{
+			if (slots_[slot].id == id)
+				return slots_[slot].index;
+		}
+
+		return NO_ENTRY;
+	}
+
+	void SweepAndPrune::rebuildSlots()
+	{
+		// entries move around every tick, so the table is refilled rather than updated
+		std::size_t capacity = 16;
+		while (capacity < 2 * entries_.size())
+			capacity *= 2;
+
+		slots_.assign(capacity, Slot{ NO_ID, NO_ENTRY });
+
+		const std::size_t mask = capacity - 1;
+		for (std::size_t i = 0; i < entries_.size(); ++i)
+		{
+			std::size_t slot = hashId(entries_[i].id) & mask;
+			while (slots_[slot].id != NO_ID)
+				slot = (slot + 1) & mask;
+
+			slots_[slot] = Slot{ entries_[i].id, i };
+		}
+	}
+}
\ No newline at end of file
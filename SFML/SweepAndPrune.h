@@ -0,0 +1,87 @@
+/**
+* @file
+* @author
+* Justin Lange 2018
+* @version 1.0
+*
+*
+* @section DESCRIPTION
+* SweepAndPrune Class
+*
+*
+*
+*
+* @section LICENSE
+*
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+
+#pragma once
+
+#include "Broadphase.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace GEX
+{
+	// Sort and sweep along y, the axis almost everything in a vertical scroller moves
+	// along. The order of the last tick is kept and fixed up with an insertion sort,
+	// which is close to linear because nodes barely change places from tick to tick.
+	// Entries are found again by node id through a small open addressing table.
+	class SweepAndPrune : public Broadphase
+	{
+	public:
+								SweepAndPrune();
+
+		void					update(const std::vector<SceneNode*>& nodes) override;
+		void					findPairs(const CollisionMatrix& matrix, CollisionPairs& collisionPairs) const override;
+		bool					query(const sf::FloatRect& area, const Visitor& visitor) const override;
+		std::size_t				getNodeCount() const override;
+
+	private:
+		struct Entry
+		{
+			SceneNode*			node;		// never dereferenced until the node shows up again in update()
+			std::uint64_t		id;
+			sf::FloatRect		bounds;
+			float				bottom;
+			unsigned int		category;
+			std::uint64_t		stamp;
+		};
+
+		// node id to entries_ index; an id of NO_ID marks an empty slot
+		struct Slot
+		{
+			std::uint64_t		id;
+			std::size_t			index;
+		};
+
+		std::size_t				findEntry(std::uint64_t id) const;
+		void					rebuildSlots();
+
+	private:
+		std::vector<Entry>		entries_;		// sorted by bounds.top
+		std::vector<Slot>		slots_;			// a power of two, at least twice as many as entries_
+		std::vector<SceneNode*>	newcomers_;
+		std::uint64_t			stamp_;
+		float					maxHeight_;		// tallest box, bounds how far back a query has to look
+	};
+}
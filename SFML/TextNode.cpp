@@ -35,24 +35,57 @@
 #include "TextNode.h"
 #include "FontManager.h"
 #include "Utility.h"
+#include "SpriteBatch.h"
 
 #include <SFML\Graphics\RenderTarget.hpp>
 
 
 TextNode::TextNode(const std::string & text)
+	: text_()
+	, needsRecentre_(true)
 {
-	text_.setFont(GEX::FontManager::getInstance().get(GEX::FontID::Main));
 	text_.setCharacterSize(20);
 	setString(text);
 }
 
 void TextNode::setString(const std::string & text)
 {
+	if (text_.getString() == text)
+		return;
+
 	text_.setString(text);
-	GEX::centerOrigin(text_);
+	needsRecentre_ = true;
+}
+
+sf::FloatRect TextNode::getDrawBounds() const
+{
+	// the font and the centring wait for the next draw, so a new string has no size yet
+	if (needsRecentre_)
+		return UNBOUNDED;
+
+	return getWorldTransform().transformRect(text_.getGlobalBounds());
 }
 
 void TextNode::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
 {
+	prepareText();
 	target.draw(text_, states);
 }
+
+void TextNode::batchCurrent(GEX::SpriteBatch & batch, sf::RenderStates states) const
+{
+	prepareText();
+	batch.add(text_, states);
+}
+
+void TextNode::prepareText() const
+{
+	if (!needsRecentre_)
+		return;
+
+	if (!text_.getFont())
+		text_.setFont(GEX::FontManager::getInstance().get(GEX::FontID::Main));
+
+	GEX::centerOrigin(text_);
+	needsRecentre_ = false;
+}
@@ -48,11 +48,19 @@ public:
 
 	void				setString(const std::string& text);
 
+	sf::FloatRect		getDrawBounds() const override;
+
 private:
 	virtual void		drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const;
+	virtual void		batchCurrent(GEX::SpriteBatch& batch, sf::RenderStates states) const;
+
+		// font and centring need glyph metrics, which upload glyphs to the GPU,
+		// so they wait until the text is actually drawn
+	void				prepareText() const;
 
 private:
-	sf::Text			text_;
+	mutable sf::Text	text_;
+	mutable bool		needsRecentre_;
 	
 };
 
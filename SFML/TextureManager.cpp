@@ -57,17 +57,52 @@ namespace GEX
 			throw std::runtime_error("Texture failed to load from " + path);
 		}
 
+		sizes_.insert(std::make_pair(id, texture->getSize()));
+
 		auto rc = textures_.insert(std::make_pair(id, std::move(texture)));
 		assert(rc.second);
 	}
 
+	void TextureManager::loadPlaceholder(TextureID id, sf::Vector2u size)
+	{
+		auto rc = sizes_.insert(std::make_pair(id, size));
+		assert(rc.second);
+	}
+
 	sf::Texture& TextureManager::get(TextureID id) const
+	{
+		sf::Texture* texture = find(id);
+
+		assert(texture);
+
+		return *texture;
+	}
+
+	sf::Texture* TextureManager::find(TextureID id) const
 	{
 		auto found = textures_.find(id);
 
-		assert(found != textures_.end());
+		return found != textures_.end() ? found->second.get() : nullptr;
+	}
+
+	sf::Vector2u TextureManager::getSize(TextureID id) const
+	{
+		auto found = sizes_.find(id);
+
+		assert(found != sizes_.end());
+
+		return found->second;
+	}
+
+	sf::Sprite TextureManager::makeSprite(TextureID id, const sf::IntRect& textureRect) const
+	{
+		sf::Sprite sprite;
+
+		if (const sf::Texture* texture = find(id))
+			sprite.setTexture(*texture);
 
-		return *(found->second);
+		sprite.setTextureRect(textureRect);
+		return sprite;
 	}
 
 }
\ No newline at end of file
@@ -50,10 +50,21 @@ namespace GEX
 															~TextureManager();
 
 		void												load(TextureID id, const std::string& path);
+
+			// records only the size of id, no sf::Texture is made: a texture is a GL
+			// resource and would create a GL context. find() returns nullptr for it.
+		void												loadPlaceholder(TextureID id, sf::Vector2u size);
 		sf::Texture&										get(TextureID id) const;
+		sf::Texture*										find(TextureID id) const;
+		sf::Vector2u										getSize(TextureID id) const;
+
+			// a sprite showing textureRect of id; a placeholder leaves the texture
+			// unset, the rect alone still gives the sprite its bounds
+		sf::Sprite											makeSprite(TextureID id, const sf::IntRect& textureRect) const;
 
 	private:
 		std::map<TextureID, std::unique_ptr<sf::Texture>>	textures_;
+		std::map<TextureID, sf::Vector2u>					sizes_;
 	};
 }
 
@@ -37,8 +37,6 @@
 #include <SFML\Graphics\Sprite.hpp>
 #include <SFML\Graphics\Text.hpp>
 
-#include <random>
-
 #define _USE_MATH_DEFINES
 #include <cmath>
 #include <cassert>
@@ -76,15 +74,6 @@ namespace GEX
 		return static_cast<float>(M_PI) / 180.f * degree;
 	}
 
-	int randomInt(int exclusiveMax)
-	{
-		std::random_device rd;
-		std::mt19937 rng(rd());
-		std::uniform_int_distribution<int> uni(0, exclusiveMax - 1);
-
-		return uni(rng);
-	}
-
 	float length(sf::Vector2f vector)
 	{
 		return std::sqrt((vector.x * vector.x) + (vector.y * vector.y));
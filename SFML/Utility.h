@@ -52,8 +52,6 @@ namespace GEX
 	float			toDegree(float radian);
 	float			toRadian(float degree);
 
-	int				randomInt(int exclusiveMax);
-
 	float			length(sf::Vector2f vector);
 	sf::Vector2f	unitVector(sf::Vector2f vector);
 }
@@ -34,25 +34,58 @@
 
 #include "World.h"
 #include "Aircraft.h"
+#include "EmitterNode.h"
 #include "Pickup.h"
 #include "Projectile.h"
 #include "ParticleNode.h"
+#include "Profiler.h"
+
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/System/Clock.hpp>
+
+#include <algorithm>
 
 namespace GEX
 { 
 	World::World(sf::RenderWindow& window)
-	: window_(window)
-	, worldView_(window.getView())
+	: World(window.getView(), &window, Random::makeSeed())
+	{}
+
+	World::World(sf::Vector2f viewSize, std::uint64_t seed)
+	: World(sf::View(sf::FloatRect(0.f, 0.f, viewSize.x, viewSize.y)), nullptr, seed)
+	{}
+
+	World::World(const sf::View& view, sf::RenderTarget* target, std::uint64_t seed)
+	: target_(target)
+	, worldView_(view)
 	, textures_()
+	, random_(seed)
+	, categoryRegistry_()
 	, sceneGraph_()
 	, sceneLayers_()
 	, worldBounds_(0.f, 0.f, worldView_.getSize().x, 5000.f)
 	, spawnPosition_(worldView_.getSize().x / 2.f, worldBounds_.height - worldView_.getSize().y / 2.f)
 	, scrollSpeed_(-50.f)
 	, playerAircraft_(nullptr)
+	, bullets_(nullptr)
+	, score_(0)
+	, enemyGrid_()
+	, collisionMatrix_()
+	, broadphaseType_(Broadphase::Type::SweepAndPrune)
+	, broadphase_(Broadphase::create(broadphaseType_))
+	, collidables_()
+	, collisionPairs_()
+	, particleBudget_()
+	, drawTime_(sf::Time::Zero)
+	, spriteBatch_()
 	{
+		// commands are dispatched through the registry instead of walking the tree
+		sceneGraph_.setCategoryRegistry(&categoryRegistry_);
+
 		loadTextures();
 		buildScene();
+		reserveStorage();
+		buildCollisionMatrix();
 
 		//prepare the view
 		worldView_.setCenter(spawnPosition_);
@@ -60,6 +93,9 @@ namespace GEX
 
 	void World::update(sf::Time dt, CommandQueue& commands)
 	{
+		GEX_PROFILE_SCOPE("World::update");
+		sf::Clock frameClock;
+
 		// Scroll screen and reset player velocity
 		worldView_.move(0.f, scrollSpeed_ * dt.asSeconds());
 		playerAircraft_->setVelocity(0.f, 0.f);
@@ -70,10 +106,13 @@ namespace GEX
 		// Guide missiles
 		guideMissiles();
 
-		// Run all the commands in the command queue
-		while (!commandQueue_.isEmpty())
-		{ 
-			sceneGraph_.onCommand(commandQueue_.pop(), dt);
+		// Run this frame's commands; anything they queue runs next frame
+		{
+			GEX_PROFILE_SCOPE("World::drainCommands");
+			commandQueue_.drain([this, dt](const Command& command)
+			{
+				categoryRegistry_.onCommand(command, dt);
+			});
 		}
 		adaptPlayerVelocity();
 
@@ -81,16 +120,23 @@ namespace GEX
 		handleCollision();
 
 		// Destroy all wrecks on the battlefield
-		sceneGraph_.removeWrecks();
+		{
+			GEX_PROFILE_SCOPE("World::removeWrecks");
+			sceneGraph_.removeWrecks();
+		}
 
 		// Spawn enemies
 		spawnEnemies();
 
 		// Regular update step, and adapt position of aircraft
-		sceneGraph_.update(dt, getCommandQueue());
+		{
+			GEX_PROFILE_SCOPE("World::updateSceneGraph");
+			sceneGraph_.update(dt, getCommandQueue());
+		}
 		adaptPlayerPosition();
 
-		
+		// Hold particles to the budget, measured against this update and the last draw
+		particleBudget_.update(frameClock.getElapsedTime() + drawTime_);
 	}
 
 	void World::adaptPlayerVelocity()
@@ -144,26 +190,28 @@ namespace GEX
 		addEnemy(Aircraft::Type::Avenger, -200.f, 4200.f);
 		addEnemy(Aircraft::Type::Raptor, 200.f, 4200.f);
 		addEnemy(Aircraft::Type::Raptor, 0.f, 4400.f);
-
-		std::sort(enemySpawnPoints_.begin(), enemySpawnPoints_.end(), 
-			[](Spawnpoint lhs, Spawnpoint rhs)
-		{
-			return lhs.y < rhs.y;
-		});
 	}
 
 	void World::addEnemy(Aircraft::Type type, float relX, float relY)
 	{
 		Spawnpoint spawnpoint(type, spawnPosition_.x + relX, spawnPosition_.y - relY);
-		enemySpawnPoints_.push_back(spawnpoint);
+
+		// kept sorted by y, spawnEnemies() takes the next one off the back
+		auto position = std::upper_bound(enemySpawnPoints_.begin(), enemySpawnPoints_.end(), spawnpoint,
+			[](const Spawnpoint& lhs, const Spawnpoint& rhs)
+		{
+			return lhs.y < rhs.y;
+		});
+		enemySpawnPoints_.insert(position, spawnpoint);
 	}
 
 	void World::spawnEnemies()
 	{
+		GEX_PROFILE_SCOPE("World::spawnEnemies");
 		while (!enemySpawnPoints_.empty() && enemySpawnPoints_.back().y > getBattlefieldBounds().top)
 		{
 			auto spawnpoint = enemySpawnPoints_.back();
-			std::unique_ptr<Aircraft> enemy(new Aircraft(spawnpoint.type, textures_));
+			std::unique_ptr<Aircraft> enemy(new Aircraft(spawnpoint.type, textures_, random_));
 			enemy->setPosition(spawnpoint.x, spawnpoint.y);
 			enemy->setRotation(180);
 			sceneLayers_[UpperAir]->attachChild(std::move(enemy));
@@ -186,14 +234,18 @@ namespace GEX
 
 	void World::guideMissiles()
 	{
-		// build a list of active Enemies
-		Command enemyCollector;
-		enemyCollector.category = Category::EnemyAircraft;
-		enemyCollector.action = derivedAction<Aircraft>([this](Aircraft& enemy, sf::Time dt)
+		GEX_PROFILE_SCOPE("World::guideMissiles");
+		// index the live enemies by position, one transform lookup each
+		activeEnemies_.clear();
+		categoryRegistry_.collectNodes(Category::EnemyAircraft, activeEnemies_);
+
+		enemyGrid_.clear();
+		for (SceneNode* enemy : activeEnemies_)
 		{
-			if (!enemy.isDestroyed())
-				activeEnemies_.push_back(&enemy);
-		});
+			if (!enemy->isDestroyed())
+				enemyGrid_.insert(*enemy, enemy->getWorldPosition());
+		}
+		enemyGrid_.build();
 
 		Command missileGuider;
 		missileGuider.category = Category::Type::AlliedProjectile;
@@ -203,87 +255,91 @@ namespace GEX
 			if (!missile.isGuided())
 				return;
 
-			float minDistance = std::numeric_limits<float>::max();
-			Aircraft* closestEnemy = nullptr;
-
-			for (Aircraft* e : activeEnemies_)
-			{
-				auto d = distance(missile, *e);
-				if (d < minDistance)
-				{
-					minDistance = d;
-					closestEnemy = e;
-				}
-			}
+			SceneNode* closestEnemy = enemyGrid_.findNearest(missile.getWorldPosition());
 
 			if (closestEnemy)
 				missile.guidedTowards(closestEnemy->getWorldPosition());
 		});
 
-		commandQueue_.push(enemyCollector);
-		commandQueue_.push(missileGuider);
-		activeEnemies_.clear();
+		commandQueue_.push(std::move(missileGuider));
 	}
 
-	bool matchesCategory(SceneNode::Pair& colliders, Category::Type type1, Category::Type type2)
+	void World::buildCollisionMatrix()
 	{
-		unsigned int category1 = colliders.first->getCategory();
-		unsigned int category2 = colliders.second->getCategory();
-
-		// Make sure pair entry has category type1 and second has type2
-		if (type1 & category1 && type2 & category2)
+		collisionMatrix_.allow(Category::PlayerAircraft, Category::EnemyAircraft, [this](SceneNode& first, SceneNode& second)
 		{
-			return true;
-		}
-		else if (type1 & category2 && type2 & category1)
+			auto& player = static_cast<Aircraft&>(first);
+			auto& enemy = static_cast<Aircraft&>(second);
+
+			player.damage(enemy.getHitpoints());
+			damageAircraft(enemy, enemy.getHitpoints());
+		});
+
+		collisionMatrix_.allow(Category::PlayerAircraft, Category::Pickup, [](SceneNode& first, SceneNode& second)
 		{
-			std::swap(colliders.first, colliders.second);
-			return true;
-		}
-		else
+			auto& player = static_cast<Aircraft&>(first);
+			auto& pickup = static_cast<Pickup&>(second);
+
+			pickup.apply(player);
+			pickup.destroy();
+		});
+
+		auto projectileHit = [this](SceneNode& first, SceneNode& second)
 		{
-			return false;
-		}
+			auto& aircraft = static_cast<Aircraft&>(first);
+			auto& projectile = static_cast<Projectile&>(second);
+
+			damageAircraft(aircraft, projectile.getDamage());
+			projectile.destroy();
+		};
+
+		collisionMatrix_.allow(Category::PlayerAircraft, Category::EnemyProjectile, projectileHit);
+		collisionMatrix_.allow(Category::EnemyAircraft, Category::AlliedProjectile, projectileHit);
+	}
+
+	void World::updateBroadphase()
+	{
+		// only the categories the matrix has a rule for take part in the broadphase
+		collidables_.clear();
+		categoryRegistry_.collectNodes(collisionMatrix_.getCategories(), collidables_);
+
+		collidables_.erase(std::remove_if(collidables_.begin(), collidables_.end(), [](SceneNode* node) { return node->isDestroyed(); }), 
+						   collidables_.end());
+
+		broadphase_->update(collidables_);
 	}
 
 	void World::handleCollision()
 	{
+		GEX_PROFILE_SCOPE("World::handleCollision");
 		//build a list of colliding pairs of SceneNodes
-		std::set<SceneNode::Pair> collisionPairs;
-		sceneGraph_.checkSceneCollision(sceneGraph_, collisionPairs);
+		collisionPairs_.clear();
+		updateBroadphase();
+		broadphase_->findPairs(collisionMatrix_, collisionPairs_);
 
-		for (SceneNode::Pair pair : collisionPairs)
+		for (const SceneNode::Pair& pair : collisionPairs_)
+			collisionMatrix_.dispatch(*pair.first, *pair.second);
+
+		// bullets are not nodes, they test themselves against the same grid
+		bullets_->checkCollisions(*broadphase_, [this](SceneNode& target, int damage)
 		{
-			if (matchesCategory(pair, Category::Type::PlayerAircraft, Category::Type::EnemyAircraft))
-			{
-				auto& player = static_cast<Aircraft&>(*pair.first);
-				auto& enemy = static_cast<Aircraft&>(*pair.second);
+			damageAircraft(static_cast<Aircraft&>(target), damage);
+		});
+	}
 
-				player.damage(enemy.getHitpoints());
-				enemy.destroy();
-			}
-			else if (matchesCategory(pair, Category::Type::PlayerAircraft, Category::Type::Pickup))
-			{
-				auto& player = static_cast<Aircraft&>(*pair.first);
-				auto& pickup = static_cast<Pickup&>(*pair.second);
-
-				pickup.apply(player);
-				pickup.destroy();
-			}
-			else if (matchesCategory(pair, Category::Type::PlayerAircraft, Category::Type::EnemyProjectile) ||
-				     matchesCategory(pair, Category::Type::EnemyAircraft, Category::Type::AlliedProjectile))
-			{
-				auto& aircraft = static_cast<Aircraft&>(*pair.first);
-				auto& projectile = static_cast<Projectile&>(*pair.second);
+	void World::damageAircraft(Aircraft& aircraft, int damage)
+	{
+		// several hits can land on the same aircraft in one frame, only the killing one scores
+		bool wasAlive = !aircraft.isDestroyed();
+		aircraft.damage(damage);
 
-				aircraft.damage(projectile.getDamage());
-				projectile.destroy();
-			}
-		}
+		if (wasAlive && aircraft.isDestroyed() && !aircraft.isAllied())
+			++score_;
 	}
 
 	void World::destroyEntitiesOutOfView()
 	{
+		GEX_PROFILE_SCOPE("World::destroyEntitiesOutOfView");
 		Command command;
 		command.category = Category::Type::Projectile | Category::Type::EnemyAircraft;
 		command.action = derivedAction<Entity>([this](Entity& e, sf::Time dt)
@@ -292,13 +348,35 @@ namespace GEX
 				e.remove();
 		});
 
-		commandQueue_.push(command);
+		commandQueue_.push(std::move(command));
+
+		bullets_->removeOutside(getBattlefieldBounds());
 	}
 
 	void World::draw()
 	{
-		window_.setView(worldView_);
-		window_.draw(sceneGraph_);
+		if (!target_)
+			return;
+
+		GEX_PROFILE_SCOPE("World::draw");
+		sf::Clock drawClock;
+
+		// refresh the bounds the layers are culled against; headless worlds never need them
+		{
+			GEX_PROFILE_SCOPE("World::updateDrawBounds");
+			sceneGraph_.updateDrawBounds();
+		}
+
+		target_->setView(worldView_);
+
+		// Sprites of a layer are drawn with one call per texture, flushed before the next layer
+		for (SceneNode* layer : sceneLayers_)
+		{
+			layer->drawBatched(spriteBatch_, sf::RenderStates::Default, getViewBounds());
+			spriteBatch_.flush(*target_);
+		}
+
+		drawTime_ = drawClock.getElapsedTime();
 	}
 
 	CommandQueue& World::getCommandQueue()
@@ -306,6 +384,21 @@ namespace GEX
 		return commandQueue_;
 	}
 
+	void World::setRenderTarget(sf::RenderTarget* target)
+	{
+		target_ = target;
+	}
+
+	bool World::isHeadless() const
+	{
+		return target_ == nullptr;
+	}
+
+	std::uint64_t World::getSeed() const
+	{
+		return random_.getSeed();
+	}
+
 	bool World::hasAlivePlayer() const
 	{
 		return !playerAircraft_->isMarkedForRemoval();
@@ -316,13 +409,35 @@ namespace GEX
 		return !worldBounds_.contains(playerAircraft_->getPosition());
 	}
 
+	int World::getScore() const
+	{
+		return score_;
+	}
+
+	void World::setBroadphase(Broadphase::Type type)
+	{
+		if (type == broadphaseType_)
+			return;
+
+		broadphaseType_ = type;
+		broadphase_ = Broadphase::create(type);
+	}
+
+	Broadphase::Type World::getBroadphase() const
+	{
+		return broadphaseType_;
+	}
+
 	void World::loadTextures()
 	{
-		textures_.load(GEX::TextureID::Entities, "Media/Textures/Entities.png");
-		textures_.load(GEX::TextureID::Jungle, "Media/Textures/JungleBig.png");
-		textures_.load(GEX::TextureID::Particle, "Media/Textures/Particle.png");
-		textures_.load(GEX::TextureID::Explosion, "Media/Textures/Explosion.png");
-		textures_.load(GEX::TextureID::FinishLine, "Media/Textures/FinishLine.png");
+		// a headless world has nothing to draw into, so it keeps only the image sizes
+		for (const WorldTexture& texture : WORLD_TEXTURES)
+		{
+			if (isHeadless())
+				textures_.loadPlaceholder(texture.id, sf::Vector2u(texture.width, texture.height));
+			else
+				textures_.load(texture.id, texture.file);
+		}
 	}
 
 	void World::buildScene()
@@ -336,25 +451,32 @@ namespace GEX
 			sceneGraph_.attachChild(std::move(layer));
 		}
 
+		// Bullets, all of them in one node
+		std::unique_ptr<BulletNode> bullets(new BulletNode(textures_));
+		bullets_ = bullets.get();
+		sceneLayers_[UpperAir]->attachChild(std::move(bullets));
+
 		// Particle System
 		std::unique_ptr<ParticleNode> smoke(new ParticleNode(Particle::Type::Smoke, textures_));
+		particleBudget_.addParticleSystem(*smoke);
 		sceneLayers_[LowerAir]->attachChild(std::move(smoke));
 
 		std::unique_ptr<ParticleNode> fire(new ParticleNode(Particle::Type::Propellant, textures_));
+		particleBudget_.addParticleSystem(*fire);
 		sceneLayers_[LowerAir]->attachChild(std::move(fire));
 
 		// draw background
-		sf::Texture& texture = textures_.get(TextureID::Jungle);
 		sf::IntRect textureRect(worldBounds_);
-		texture.setRepeated(true);
+		if (sf::Texture* texture = textures_.find(TextureID::Jungle))
+			texture->setRepeated(true);
 
-		std::unique_ptr<SpriteNode> backgroundSprite(new SpriteNode(texture, textureRect));
+		std::unique_ptr<SpriteNode> backgroundSprite(new SpriteNode(textures_.makeSprite(TextureID::Jungle, textureRect)));
 		backgroundSprite->setPosition(worldBounds_.left, worldBounds_.top);
 		sceneLayers_[Background]->attachChild(std::move(backgroundSprite));
 
 		// add player aircraft & game objects
 			//player
-		std::unique_ptr<Aircraft> leader(new Aircraft(Aircraft::Type::Eagle, textures_));
+		std::unique_ptr<Aircraft> leader(new Aircraft(Aircraft::Type::Eagle, textures_, random_));
 		leader->setPosition(spawnPosition_);
 		leader->setVelocity(50.f, scrollSpeed_);
 		playerAircraft_ = leader.get();
@@ -363,4 +485,24 @@ namespace GEX
 		// add enemy planes
 		addEnemies();
 	}
+
+	void World::reserveStorage()
+	{
+		// missiles and pickups are created while commands drain; with their pools, their
+		// registry buckets, the air layer and the child lists of a missile's two emitters
+		// ready, the first ones don't reach the heap
+		const std::size_t PROJECTILES = 64;
+		const std::size_t PICKUPS = 64;
+		const std::size_t AIR_NODES = 256;
+
+		ObjectPool<Projectile>::getInstance().reserve(PROJECTILES);
+		ObjectPool<EmitterNode>::getInstance().reserve(2 * PROJECTILES);
+		ObjectPool<Pickup>::getInstance().reserve(PICKUPS);
+		SceneNode::reserveSpareChildLists(PROJECTILES, 2);
+
+		categoryRegistry_.reserve(Category::AlliedProjectile);
+		categoryRegistry_.reserve(Category::EnemyProjectile);
+		categoryRegistry_.reserve(Category::Pickup);
+		sceneLayers_[UpperAir]->reserveChildren(AIR_NODES);
+	}
 }
\ No newline at end of file
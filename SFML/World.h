@@ -39,16 +39,28 @@
 #include <SFML\Graphics\Texture.hpp>
 
 #include "SceneNode.h"
+#include "CategoryRegistry.h"
 #include "SpriteNode.h"
 #include "TextureManager.h"
 #include "Aircraft.h"
 #include "Category.h"
 #include "CommandQueue.h"
-
+#include "Broadphase.h"
+#include "CollisionMatrix.h"
+#include "CollisionPairs.h"
+#include "NeighbourGrid.h"
+#include "BulletNode.h"
+#include "ParticleBudget.h"
+#include "SpriteBatch.h"
+#include "Random.h"
+
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 namespace sf
 {
+	class RenderTarget;
 	class RenderWindow;
 }
 
@@ -57,31 +69,58 @@ namespace GEX
 	class World
 	{
 	public:
+			// renders into window, taking the view from it; seeded from std::random_device
 		explicit					World(sf::RenderWindow& window);
 
+			// simulation only: a virtual view of viewSize and no window, textures or GL
+			// context, sprites keep just their texture rects. draw() does nothing until
+			// a render target is attached, and then draws them untextured.
+			// The same seed and the same commands play the same game.
+									World(sf::Vector2f viewSize, std::uint64_t seed);
+
 		void						update(sf::Time dt, CommandQueue& commands);
 		void						draw();
 
+		void						setRenderTarget(sf::RenderTarget* target);
+		bool						isHeadless() const;
+
 		CommandQueue&				getCommandQueue();
+		std::uint64_t				getSeed() const;
 
 		bool						hasAlivePlayer() const;
 		bool						hasPlayerReachedEnd() const;
 
+			// one point for every enemy aircraft shot down or rammed
+		int							getScore() const;
+
+			// switches how collision candidates are found, the game plays the same with each
+		void						setBroadphase(Broadphase::Type type);
+		Broadphase::Type			getBroadphase() const;
+
+			// adds a spawn point relative to the player's start, e.g. for benchmark scenarios;
+			// the enemy appears once the spawn point scrolls onto the battlefield
+		void						addEnemy(Aircraft::Type type, float relX, float relY);
+
 	private:
+									World(const sf::View& view, sf::RenderTarget* target, std::uint64_t seed);
+
 		void						loadTextures();
 		void						buildScene();
+		void						reserveStorage();
 		void						adaptPlayerVelocity();
 		void						adaptPlayerPosition();
 
 		void						addEnemies();
-		void						addEnemy(Aircraft::Type type, float relX, float relY);
 		void						spawnEnemies();
 
 		sf::FloatRect				getViewBounds() const;
 		sf::FloatRect				getBattlefieldBounds() const;
 
 		void						guideMissiles();		
+		void						buildCollisionMatrix();
+		void						updateBroadphase();
 		void						handleCollision();
+		void						damageAircraft(Aircraft& aircraft, int damage);
 
 		void						destroyEntitiesOutOfView();
 
@@ -108,10 +147,12 @@ namespace GEX
 		};
 
 	private:
-		sf::RenderWindow&			window_;
+		sf::RenderTarget*			target_;
 		sf::View					worldView_;
 		TextureManager				textures_;
+		Random						random_;
 
+		CategoryRegistry			categoryRegistry_;
 		SceneNode					sceneGraph_;
 		std::vector<SceneNode*>		sceneLayers_;
 
@@ -120,9 +161,22 @@ namespace GEX
 		sf::Vector2f				spawnPosition_;
 		float						scrollSpeed_;
 		Aircraft*					playerAircraft_;
+		BulletNode*					bullets_;
+		int							score_;
 
 		std::vector<Spawnpoint>		enemySpawnPoints_;
 
-		std::vector<Aircraft*>		activeEnemies_;
+		std::vector<SceneNode*>		activeEnemies_;
+		NeighbourGrid				enemyGrid_;
+
+		CollisionMatrix				collisionMatrix_;
+		Broadphase::Type			broadphaseType_;
+		std::unique_ptr<Broadphase>	broadphase_;
+		std::vector<SceneNode*>		collidables_;
+		CollisionPairs				collisionPairs_;
+
+		ParticleBudget				particleBudget_;
+		sf::Time					drawTime_;
+		SpriteBatch					spriteBatch_;
 	};
 }